@@ -36,72 +36,182 @@
  */
 
 // This project.
-#include "Rnfpp.hpp"
+#include "kernels.hpp"
 
 
 
 /**
- * \brief   Construct a new Rnfpp object.
+ * \brief   Construct a new Rnpp object.
  *
  * This is the default constructor which will prepare a new vector.
  */
 
-Rnfpp :: Rnfpp (void)
+template <typename T>
+Rnpp <T> :: Rnpp (void)
 {
-    Rnfpp (0x0);
+    KERNEL_PROFILE (Rnpp_construction, 0x0, 0x0);
     return;
 }
 
 
 
 /**
- * \brief   Construct a new Rnfpp object.
+ * \brief   Construct a new Rnpp object.
  * \param   dimension   The expected initial dimension.
  *
  * This constructor will prepare a new vector and give it the expected initial
- * dimension.  This benefits the performance in later applications of the
- * resulting object.
+ * dimension.  All components will be zero.
  */
 
-Rnfpp :: Rnfpp (const dimension_t dimension)
+template <typename T>
+Rnpp <T> :: Rnpp (const dimension_t dimension) : components (dimension)
 {
-    this -> components = fvec_t (dimension);
+    KERNEL_PROFILE (Rnpp_construction, dimension, dimension * sizeof (T));
     return;
 }
 
 
 
 /**
- * \brief   Construct a new Rnfpp object from a given component vector.
+ * \brief   Construct a new Rnpp object from a given component vector.
  * \param   components  The components to hold.
  *
  * This constructor prepares a new vector and initialises it with the components
- * of the given `std :: vector <float>`.
+ * of the given `std :: vector <T>`.
  */
 
-Rnfpp :: Rnfpp (const fvec_t & components)
+template <typename T>
+Rnpp <T> :: Rnpp (const vec_t & components) : components (components)
 {
-    Rnfpp (components.size ());
+    KERNEL_PROFILE (Rnpp_construction, components.size (),
+                    components.size () * sizeof (T));
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp object as a copy of another one.
+ * \param   rnpp    The vector to copy.
+ *
+ * This constructor prepares a new vector and initialises it with the components
+ * of the given one.
+ */
+
+template <typename T>
+Rnpp <T> :: Rnpp (const Rnpp <T> & rnpp) : components (rnpp.components)
+{
+    KERNEL_PROFILE (Rnpp_copy, rnpp.components.size (),
+                    rnpp.components.size () * sizeof (T));
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp object from a given component vector.
+ * \param   components  The components to adopt.
+ *
+ * This constructor prepares a new vector and takes over the storage of the
+ * given `std :: vector <T>` without copying it.
+ */
+
+template <typename T>
+Rnpp <T> :: Rnpp (vec_t && components) noexcept
+    : components (move (components))
+{
+    KERNEL_PROFILE (Rnpp_construction, this -> components.size (), 0x0);
+    return;
+}
 
-    for (dimension_t i = 0x0; i < components.size (); i++)
-        (* this)[i] = components.at (i);
 
+
+/**
+ * \brief   Construct a new Rnpp object from a given buffer.
+ * \param   components  The components to copy.
+ * \param   dimension   The number of components to copy.
+ *
+ * This constructor prepares a new vector and initialises it with the first
+ * `dimension` components of the given buffer.  The storage is allocated once
+ * and filled with a single bulk copy.
+ */
+
+template <typename T>
+Rnpp <T> :: Rnpp (const T * components, const dimension_t dimension)
+    : components (components, components + dimension)
+{
+    KERNEL_PROFILE (Rnpp_construction, dimension, dimension * sizeof (T));
     return;
 }
 
 
 
 /**
- * \brief   Construct a new Rnfpp object from an existing one.
- * \param   rnfpp   The existing object to copy.
+ * \brief   Construct a new Rnpp object from one of another component type.
+ * \param   rnpp    The vector to convert.
  *
- * This constructor will create a deep copy of the given existing object.
+ * This constructor prepares a new vector and initialises it with the components
+ * of the given vector, rounded to the storage precision.  It only applies to
+ * vectors of another component type; the others are copied by the copy
+ * constructor.
  */
 
-Rnfpp :: Rnfpp (const Rnfpp & rnfpp)
+template <typename T>
+template <typename U, typename>
+Rnpp <T> :: Rnpp (const Rnpp <U> & rnpp) : components (rnpp.get_dimension ())
 {
-    Rnfpp (rnfpp.get_components ());
+    KERNEL_PROFILE (Rnpp_construction, rnpp.get_dimension (),
+                    rnpp.get_dimension () * sizeof (T));
+    kernel_convert (rnpp.get_components ().data (), this -> components.data (),
+                    rnpp.get_dimension ());
     return;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp :: Rnpp (void);
+template Rnbpp :: Rnpp (const dimension_t);
+template Rnbpp :: Rnpp (const Rnbpp :: vec_t &);
+template Rnbpp :: Rnpp (const Rnbpp &);
+template Rnbpp :: Rnpp (Rnbpp :: vec_t &&) noexcept;
+template Rnbpp :: Rnpp (const bfloat16_t *, const dimension_t);
+
+template Rndpp :: Rnpp (void);
+template Rndpp :: Rnpp (const dimension_t);
+template Rndpp :: Rnpp (const Rndpp :: vec_t &);
+template Rndpp :: Rnpp (const Rndpp &);
+template Rndpp :: Rnpp (Rndpp :: vec_t &&) noexcept;
+template Rndpp :: Rnpp (const double *, const dimension_t);
+
+template Rnfpp :: Rnpp (void);
+template Rnfpp :: Rnpp (const dimension_t);
+template Rnfpp :: Rnpp (const Rnfpp :: vec_t &);
+template Rnfpp :: Rnpp (const Rnfpp &);
+template Rnfpp :: Rnpp (Rnfpp :: vec_t &&) noexcept;
+template Rnfpp :: Rnpp (const float *, const dimension_t);
+
+template Rnhpp :: Rnpp (void);
+template Rnhpp :: Rnpp (const dimension_t);
+template Rnhpp :: Rnpp (const Rnhpp :: vec_t &);
+template Rnhpp :: Rnpp (const Rnhpp &);
+template Rnhpp :: Rnpp (Rnhpp :: vec_t &&) noexcept;
+template Rnhpp :: Rnpp (const half_t *, const dimension_t);
+
+template Rnbpp :: Rnpp (const Rndpp &);
+template Rnbpp :: Rnpp (const Rnfpp &);
+template Rnbpp :: Rnpp (const Rnhpp &);
+template Rndpp :: Rnpp (const Rnbpp &);
+template Rndpp :: Rnpp (const Rnfpp &);
+template Rndpp :: Rnpp (const Rnhpp &);
+template Rnfpp :: Rnpp (const Rnbpp &);
+template Rnfpp :: Rnpp (const Rndpp &);
+template Rnfpp :: Rnpp (const Rnhpp &);
+template Rnhpp :: Rnpp (const Rnbpp &);
+template Rnhpp :: Rnpp (const Rndpp &);
+template Rnhpp :: Rnpp (const Rnfpp &);
+
 /******************************************************************************/
@@ -50,16 +50,56 @@
  */
 
 // The C++ standard library.
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <future>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 // Namespace settings.
+using std :: abort;
 using std :: abs;
+using std :: atomic;
+using std :: condition_variable;
+using std :: declval;
+using std :: deque;
+using std :: enable_if;
+using std :: fputs;
+using std :: function;
+using std :: future;
+using std :: int32_t;
+using std :: int8_t;
 using std :: invalid_argument;
+using std :: is_floating_point;
+using std :: is_same;
+using std :: istream;
+using std :: make_shared;
+using std :: memcpy;
+using std :: move;
+using std :: mutex;
+using std :: ostream;
 using std :: out_of_range;
+using std :: packaged_task;
 using std :: pow;
+using std :: shared_ptr;
 using std :: sqrt;
+using std :: uint16_t;
+using std :: uint32_t;
+using std :: uint64_t;
+using std :: unique_lock;
 using std :: vector;
 
 
@@ -87,6 +127,62 @@ using std :: vector;
 
 
 
+/**
+ * \brief   The error policy.
+ *
+ * Each operation checks its preconditions and reports a violation by throwing
+ * the exception documented for it.  This policy can be changed at compile time
+ * by additional defines which need to be the same for the library and its
+ * users:
+ *
+ * - `__RNFPP_NO_EXCEPTIONS__` prints the message and aborts instead of
+ *   throwing such that the code compiles with exceptions disabled.
+ * - `__RNFPP_UNCHECKED__` assumes that the preconditions hold.  A violation
+ *   is undefined behaviour; in return, the checks are removed from the hot
+ *   paths entirely.
+ *
+ * `RNPP_VIOLATION` reports a violated precondition and follows the policy.
+ * `RNPP_FAIL` reports a failure which cannot be ruled out by the caller in
+ * advance, such as a broken stream, and is never unchecked.  Callers wishing
+ * to handle invalid arguments without exceptions are supposed to test them
+ * before, for instance with `same_dimension`.
+ */
+
+#if defined (__RNFPP_NO_EXCEPTIONS__)
+#define RNPP_FAIL(exception, message)   Rnpp_abort (message)
+#else
+#define RNPP_FAIL(exception, message)   throw exception (message)
+#endif  // ! __RNFPP_NO_EXCEPTIONS__
+
+#if ! defined (__RNFPP_UNCHECKED__)
+#define RNPP_VIOLATION(exception, message)  RNPP_FAIL (exception, message)
+#elif defined (__GNUC__)
+#define RNPP_VIOLATION(exception, message)  __builtin_unreachable ()
+#elif defined (_MSC_VER)
+#define RNPP_VIOLATION(exception, message)  __assume (0x0)
+#else
+#define RNPP_VIOLATION(exception, message)  static_cast <void> (0x0)
+#endif  // ! __RNFPP_UNCHECKED__
+
+
+
+/**
+ * \brief   Abort after a failure.
+ * \param   message The description of the failure.
+ *
+ * This function is the replacement for the exceptions in case the error policy
+ * is set to `__RNFPP_NO_EXCEPTIONS__`.
+ */
+
+[[noreturn]] inline void Rnpp_abort (const char * message) noexcept
+{
+    fputs (message, stderr);
+    fputs ("\n", stderr);
+    abort ();
+}
+
+
+
 /**
  * \brief   The dimension's data type.
  *
@@ -110,77 +206,1971 @@ typedef vector <float> fvec_t;
 
 
 /**
- * \brief   The Rnfpp vector class.
+ * \brief   The IEEE 754 half-precision storage type.
+ *
+ * This type holds a binary floating point number of 16 bits with five exponent
+ * and ten mantissa bits.  It is meant for the storage of components only; any
+ * calculation is performed after the conversion to `float`.  The conversion
+ * from `float` rounds to the nearest even value.
+ */
+
+class half_t
+{
+    private:
+        uint16_t    bits;
+
+    public:
+        half_t  (void)              noexcept;
+        half_t  (const float value) noexcept;
+
+        uint16_t    get_bits    (void)                  const noexcept;
+        void        set_bits    (const uint16_t bits)         noexcept;
+
+        operator float (void) const noexcept;
+};
+
+
+
+/**
+ * \brief   The bfloat16 storage type.
+ *
+ * This type holds the upper 16 bits of a `float`, that is, the full exponent
+ * range with a mantissa of seven bits.  It is meant for the storage of
+ * components only; any calculation is performed after the conversion to
+ * `float`.  The conversion from `float` rounds to the nearest even value.
+ */
+
+class bfloat16_t
+{
+    private:
+        uint16_t    bits;
+
+    public:
+        bfloat16_t  (void)              noexcept;
+        bfloat16_t  (const float value) noexcept;
+
+        uint16_t    get_bits    (void)                  const noexcept;
+        void        set_bits    (const uint16_t bits)         noexcept;
+
+        operator float (void) const noexcept;
+};
+
+
+
+/**
+ * \brief   The scalar type to calculate with.
  *
- * This class is a wrapper around a `std :: vector <float>` in order to perform
+ * Components of a reduced precision are meant for storage only; calculations
+ * with them are performed and accumulated in `float`.  All other component
+ * types are calculated with as they are.
+ */
+
+template <typename T>
+struct Rnpp_traits
+{
+    typedef T scalar_t;
+};
+
+template <>
+struct Rnpp_traits <bfloat16_t>
+{
+    typedef float scalar_t;
+};
+
+template <>
+struct Rnpp_traits <half_t>
+{
+    typedef float scalar_t;
+};
+
+
+
+/**
+ * \brief   The Rnpp vector class.
+ *
+ * This class is a wrapper around a `std :: vector <T>` in order to perform
  * mathematical calculations with it.  The name derives from "real vector of n
- * `float` components, written in C++".
+ * components, written in C++".  The components might be stored as `float`,
+ * `double`, `half_t` or `bfloat16_t`; the latter two are converted on the fly
+ * and calculated with in `float`.  Vectors of different component types can be
+ * compared and multiplied as long as they calculate with the same scalar type;
+ * other combinations are rejected at compile time.
  */
 
-class Rnfpp
+template <typename T>
+class Rnpp
 {
+    public:
+        typedef typename Rnpp_traits <T> :: scalar_t    scalar_t;
+        typedef vector <T>                              vec_t;
+
     private:
-        fvec_t  components;
+        vec_t   components;
 
     public:
-        EXPORT  Rnfpp   (void);
-        EXPORT  Rnfpp   (const dimension_t  dimension);
-        EXPORT  Rnfpp   (const fvec_t &     components);
-        EXPORT  Rnfpp   (const Rnfpp &      rnfpp);
+        EXPORT  Rnpp    (void);
+        EXPORT  Rnpp    (const dimension_t  dimension);
+        EXPORT  Rnpp    (const vec_t &      components);
+        EXPORT  Rnpp    (vec_t &&           components) noexcept;
+        EXPORT  Rnpp    (const T *          components,
+                         const dimension_t  dimension);
+        EXPORT  Rnpp    (const Rnpp &       rnpp);
+        EXPORT  Rnpp    (Rnpp &&            rnpp) noexcept = default;
+
+        template <typename U, typename = typename enable_if
+                              <! is_same <T, U> :: value> :: type>
+        EXPORT  explicit Rnpp (const Rnpp <U> & rnpp);
 
-        EXPORT  ~Rnfpp  (void);
+        EXPORT  ~Rnpp   (void);
 
-        EXPORT  fvec_t &    get_components  (void)  const noexcept;
+        EXPORT  Rnpp &  operator =  (const Rnpp &   rnpp) = default;
+        EXPORT  Rnpp &  operator =  (Rnpp &&        rnpp) noexcept = default;
+
+        EXPORT  vec_t &     get_components  (void)  const noexcept;
         EXPORT  dimension_t get_dimension   (void)  const noexcept;
 
-        EXPORT  void set_components (const fvec_t & components) noexcept;
-        EXPORT  void set_components (const Rnfpp  & components) noexcept;
-
-        EXPORT  Rnfpp   operator *  (const float        other)  const noexcept;
-        EXPORT  Rnfpp & operator *= (const float        other)        noexcept;
-        EXPORT  Rnfpp   operator +  (const float        other)  const noexcept;
-        EXPORT  Rnfpp   operator +  (const fvec_t &     other)  const;
-        EXPORT  Rnfpp   operator +  (const Rnfpp &      other)  const;
-        EXPORT  Rnfpp & operator += (const float        other)        noexcept;
-        EXPORT  Rnfpp & operator += (const fvec_t &     other);
-        EXPORT  Rnfpp & operator += (const Rnfpp &      other);
-        EXPORT  Rnfpp   operator -  (const float        other)  const noexcept;
-        EXPORT  Rnfpp   operator -  (const fvec_t &     other)  const;
-        EXPORT  Rnfpp   operator -  (const Rnfpp &      other)  const;
-        EXPORT  Rnfpp & operator -= (const float        other)        noexcept;
-        EXPORT  Rnfpp & operator -= (const fvec_t &     other);
-        EXPORT  Rnfpp & operator -= (const Rnfpp &      other);
-        EXPORT  Rnfpp   operator /  (const float        other)  const;
-        EXPORT  Rnfpp & operator /= (const float        other);
-        EXPORT  bool    operator == (const fvec_t &     other)  const noexcept;
-        EXPORT  bool    operator == (const Rnfpp &      other)  const noexcept;
-        EXPORT  float & operator [] (const dimension_t  index)  const;
+        EXPORT  void set_components (const vec_t &  components) noexcept;
+        EXPORT  void set_components (const Rnpp  &  components) noexcept;
+        EXPORT  void set_components (vec_t &&       components) noexcept;
+
+        EXPORT  Rnpp    operator *  (const scalar_t     other)  const noexcept;
+        EXPORT  Rnpp &  operator *= (const scalar_t     other)        noexcept;
+        EXPORT  Rnpp    operator +  (const scalar_t     other)  const noexcept;
+        EXPORT  Rnpp    operator +  (const vec_t &      other)  const;
+        EXPORT  Rnpp    operator +  (const Rnpp &       other)  const;
+        EXPORT  Rnpp &  operator += (const scalar_t     other)        noexcept;
+        EXPORT  Rnpp &  operator += (const vec_t &      other);
+        EXPORT  Rnpp &  operator += (const Rnpp &       other);
+        EXPORT  Rnpp    operator -  (const scalar_t     other)  const noexcept;
+        EXPORT  Rnpp    operator -  (const vec_t &      other)  const;
+        EXPORT  Rnpp    operator -  (const Rnpp &       other)  const;
+        EXPORT  Rnpp &  operator -= (const scalar_t     other)        noexcept;
+        EXPORT  Rnpp &  operator -= (const vec_t &      other);
+        EXPORT  Rnpp &  operator -= (const Rnpp &       other);
+        EXPORT  Rnpp    operator /  (const scalar_t     other)  const;
+        EXPORT  Rnpp &  operator /= (const scalar_t     other);
+        EXPORT  bool    operator == (const vec_t &      other)  const noexcept;
+        EXPORT  bool    operator == (const Rnpp &       other)  const noexcept;
+        EXPORT  T &     operator [] (const dimension_t  index)  const;
 
         EXPORT  void assert_affinisation    (void)                      const;
-        EXPORT  void assert_non_zero        (const float        other)  const;
+        EXPORT  void assert_non_zero        (const scalar_t     other)  const;
         EXPORT  void assert_norm_non_zero   (void)                      const;
-        EXPORT  void assert_outer_product   (const fvec_t &     other)  const;
-        EXPORT  void assert_outer_product   (const Rnfpp &      other)  const;
+        EXPORT  void assert_outer_product   (const vec_t &      other)  const;
+        EXPORT  void assert_outer_product   (const Rnpp &       other)  const;
+        EXPORT  void assert_range           (const dimension_t  index)  const;
+        EXPORT  void assert_same_dimension  (const vec_t &      other)  const;
+
+        template <typename U, typename = typename enable_if
+                              <is_same <typename Rnpp_traits <U> :: scalar_t,
+                                        scalar_t> :: value> :: type>
+        EXPORT  void assert_same_dimension  (const Rnpp <U> &   other)  const;
+
+        EXPORT  void     affinise       (void);
+        EXPORT  bool     approx_equal   (const vec_t &  other,
+                                         const scalar_t absolute,
+                                         const scalar_t relative,
+                                         const uint32_t ulps)   const noexcept;
+        EXPORT  bool     approx_equal   (const Rnpp &   other,
+                                         const scalar_t absolute,
+                                         const scalar_t relative,
+                                         const uint32_t ulps)   const noexcept;
+        EXPORT  Rnpp &   axpby          (const scalar_t alpha,
+                                         const Rnpp &   x,
+                                         const scalar_t beta);
+        EXPORT  Rnpp &   axpy           (const scalar_t alpha,
+                                         const Rnpp &   x);
+        EXPORT  scalar_t cosine         (const Rnpp &   other)  const;
+        EXPORT  scalar_t distance       (const vec_t &  other)  const;
+        EXPORT  uint64_t hash           (const bool canonical)  const noexcept;
+        EXPORT  void     homogenise     (void);
+        EXPORT  scalar_t inner          (const vec_t &  other)  const;
+        EXPORT  Rnpp &   lerp           (const Rnpp &   x,
+                                         const scalar_t t);
+        EXPORT  scalar_t norm           (void)                  const noexcept;
+        EXPORT  void     normalise      (void);
+        EXPORT  Rnpp     outer          (const vec_t &  other)  const;
+        EXPORT  Rnpp     outer          (const Rnpp &   other)  const;
+        EXPORT  bool     same_dimension (const vec_t &  other)  const noexcept;
+        EXPORT  Rnpp &   scale_add      (const scalar_t alpha,
+                                         const Rnpp &   x);
+
+        EXPORT  Rnpp    absolute    (void)                      const;
+        EXPORT  Rnpp    clamp       (const scalar_t lower,
+                                     const scalar_t upper)      const;
+        EXPORT  Rnpp    divide      (const Rnpp &   other)      const;
+        EXPORT  Rnpp    exponential (void)                      const;
+        EXPORT  Rnpp    maximum     (const Rnpp &   other)      const;
+        EXPORT  Rnpp    minimum     (const Rnpp &   other)      const;
+        EXPORT  Rnpp    multiply    (const Rnpp &   other)      const;
+        EXPORT  Rnpp    square_root (void)                      const;
+
+        EXPORT  Rnpp &  absolute_inplace    (void);
+        EXPORT  Rnpp &  clamp_inplace       (const scalar_t lower,
+                                             const scalar_t upper);
+        EXPORT  Rnpp &  divide_inplace      (const Rnpp &   other);
+        EXPORT  Rnpp &  exponential_inplace (void);
+        EXPORT  Rnpp &  maximum_inplace     (const Rnpp &   other);
+        EXPORT  Rnpp &  minimum_inplace     (const Rnpp &   other);
+        EXPORT  Rnpp &  multiply_inplace    (const Rnpp &   other);
+        EXPORT  Rnpp &  square_root_inplace (void);
+
+        EXPORT  Rnpp <scalar_t> widen (void) const;
+
+        template <typename U, typename = typename enable_if
+                              <is_same <typename Rnpp_traits <U> :: scalar_t,
+                                        scalar_t> :: value> :: type>
+        EXPORT  scalar_t distance       (const Rnpp <U> & other) const;
+
+        template <typename U, typename = typename enable_if
+                              <is_same <typename Rnpp_traits <U> :: scalar_t,
+                                        scalar_t> :: value> :: type>
+        EXPORT  scalar_t inner          (const Rnpp <U> & other) const;
+
+        template <typename U, typename = typename enable_if
+                              <is_same <typename Rnpp_traits <U> :: scalar_t,
+                                        scalar_t> :: value> :: type>
+        EXPORT  bool     same_dimension (const Rnpp <U> & other) const noexcept;
+};
+
+
+
+/**
+ * \brief   The measure of a pairwise comparison of vectors.
+ *
+ * Pairs of vectors are compared by the cosine of their angle, their Euclidean
+ * distance, their inner product or their squared Euclidean distance.
+ */
+
+enum metric_t
+{
+    Rnpp_cosine,
+    Rnpp_euclidean,
+    Rnpp_inner_product,
+    Rnpp_squared_euclidean
+};
+
+
+
+/**
+ * \brief   A contiguous batch of vectors sharing their dimension.
+ *
+ * This class stores a number of vectors of the same dimension row by row in
+ * one contiguous block of memory.  Rows are read and written as vectors of the
+ * scalar type; batched calculations convert components of a reduced precision
+ * on the fly and accumulate in `float`.
+ */
+
+template <typename T>
+class Rnpp_batch
+{
+    public:
+        typedef typename Rnpp_traits <T> :: scalar_t    scalar_t;
+        typedef Rnpp <scalar_t>                         row_t;
+        typedef vector <scalar_t>                       svec_t;
+
+    private:
+        vector <T>  components;
+        dimension_t count;
+        dimension_t dimension;
+
+    public:
+        EXPORT  Rnpp_batch  (void);
+        EXPORT  Rnpp_batch  (const dimension_t count,
+                             const dimension_t dimension);
+        EXPORT  Rnpp_batch  (const dimension_t dimension,
+                             const vector <T> & components);
+        EXPORT  Rnpp_batch  (const Rnpp_batch & batch) = default;
+        EXPORT  Rnpp_batch  (Rnpp_batch &&      batch) noexcept = default;
+
+        EXPORT  ~Rnpp_batch (void);
+
+        EXPORT  Rnpp_batch & operator = (const Rnpp_batch & batch) = default;
+        EXPORT  Rnpp_batch & operator = (Rnpp_batch &&      batch) noexcept
+                                        = default;
+
+        EXPORT  const vector <T> &  get_components  (void)  const noexcept;
+        EXPORT  dimension_t         get_count       (void)  const noexcept;
+        EXPORT  dimension_t         get_dimension   (void)  const noexcept;
+
+        EXPORT  row_t   get_row     (const dimension_t index)   const;
+        EXPORT  void    push_back   (const row_t &     row);
+        EXPORT  void    set_row     (const dimension_t index,
+                                     const row_t &     row);
+
+        EXPORT  void assert_range           (const dimension_t  index)  const;
+        EXPORT  void assert_same_dimension  (const row_t &      other)  const;
+        EXPORT  void assert_same_shape      (const Rnpp_batch & other)  const;
+
+        EXPORT  Rnpp_batch &    axpby       (const scalar_t     alpha,
+                                             const Rnpp_batch & x,
+                                             const scalar_t     beta);
+        EXPORT  Rnpp_batch &    axpy        (const scalar_t     alpha,
+                                             const Rnpp_batch & x);
+        EXPORT  Rnpp_batch &    lerp        (const Rnpp_batch & x,
+                                             const scalar_t     t);
+        EXPORT  Rnpp_batch &    scale_add   (const scalar_t     alpha,
+                                             const Rnpp_batch & x);
+
+        EXPORT  Rnpp_batch &    absolute_inplace    (void);
+        EXPORT  Rnpp_batch &    clamp_inplace       (const scalar_t     lower,
+                                                     const scalar_t     upper);
+        EXPORT  Rnpp_batch &    divide_inplace      (const row_t &      other);
+        EXPORT  Rnpp_batch &    divide_inplace      (const Rnpp_batch & other);
+        EXPORT  Rnpp_batch &    exponential_inplace (void);
+        EXPORT  Rnpp_batch &    maximum_inplace     (const row_t &      other);
+        EXPORT  Rnpp_batch &    maximum_inplace     (const Rnpp_batch & other);
+        EXPORT  Rnpp_batch &    minimum_inplace     (const row_t &      other);
+        EXPORT  Rnpp_batch &    minimum_inplace     (const Rnpp_batch & other);
+        EXPORT  Rnpp_batch &    multiply_inplace    (const row_t &      other);
+        EXPORT  Rnpp_batch &    multiply_inplace    (const Rnpp_batch & other);
+        EXPORT  Rnpp_batch &    normalise_inplace   (void);
+        EXPORT  Rnpp_batch &    square_root_inplace (void);
+
+        EXPORT  svec_t              cosine      (const row_t &  query)  const;
+        EXPORT  svec_t              distance    (const row_t &  query)  const;
+        EXPORT  vector <uint64_t>   hash        (const bool canonical)  const;
+        EXPORT  svec_t              inner       (const row_t &  query)  const;
+        EXPORT  svec_t              norms       (void)                  const;
+
+        EXPORT  svec_t  cosine      (const row_t &      query,
+                                     const svec_t &     norms)  const;
+
+        EXPORT  svec_t  distance    (const Rnpp_batch & other)  const;
+        EXPORT  svec_t  distance    (const row_t &      query,
+                                     const dimension_t  threads)  const;
+        EXPORT  svec_t  inner       (const Rnpp_batch & other)  const;
+        EXPORT  svec_t  inner       (const row_t &      query,
+                                     const dimension_t  threads)  const;
+        EXPORT  bool    place       (const dimension_t  threads);
+
+        EXPORT  svec_t  pairwise    (const Rnpp_batch & other,
+                                     const metric_t     metric,
+                                     const dimension_t  threads)  const;
+        EXPORT  svec_t  pairwise    (const Rnpp_batch & other,
+                                     const metric_t     metric,
+                                     const dimension_t  threads,
+                                     const dimension_t  first,
+                                     const dimension_t  rows)     const;
+        EXPORT  svec_t  pairwise    (const Rnpp_batch & other,
+                                     const svec_t &     norms,
+                                     const metric_t     metric,
+                                     const dimension_t  threads,
+                                     const dimension_t  first,
+                                     const dimension_t  rows)     const;
+
+        EXPORT  vector <dimension_t> nearest (const row_t &     query,
+                                              const dimension_t neighbours)
+                                             const;
+
+        EXPORT  svec_t      householder     (void);
+        EXPORT  dimension_t orthonormalise  (void);
+};
+
+
+
+/**
+ * \brief   Abbreviations for the supported component types.
+ *
+ * The vectors and the batches are named after the type of their components,
+ * following the naming scheme of `Rnfpp`.
+ */
+
+typedef Rnpp        <bfloat16_t>    Rnbpp;
+typedef Rnpp        <double>        Rndpp;
+typedef Rnpp        <float>         Rnfpp;
+typedef Rnpp        <half_t>        Rnhpp;
+typedef Rnpp_batch  <bfloat16_t>    Rnbpp_batch;
+typedef Rnpp_batch  <double>        Rndpp_batch;
+typedef Rnpp_batch  <float>         Rnfpp_batch;
+typedef Rnpp_batch  <half_t>        Rnhpp_batch;
+
+
+
+/**
+ * \brief   A handle to a vector of a validated dimension.
+ *
+ * This class refers to the components of a vector or of a row of a batch after
+ * their dimension has been checked once.  Handles are combined by comparing
+ * their validated dimensions only, such that loops over many pairs do not
+ * repeat the checks of the referred vectors; combining handles of different
+ * dimensions throws.  A handle does not own the components and becomes
+ * invalid as soon as the referred vector or batch is resized or destroyed.
+ */
+
+template <typename T>
+class Rnpp_checked
+{
+    public:
+        typedef typename Rnpp_traits <T> :: scalar_t scalar_t;
+
+    private:
+        const T *   components;
+        dimension_t dimension;
+
+    public:
+        EXPORT  Rnpp_checked    (const Rnpp <T> &       rnpp,
+                                 const dimension_t      dimension);
+        EXPORT  Rnpp_checked    (const Rnpp_batch <T> & batch,
+                                 const dimension_t      index);
+
+        EXPORT  const T *   get_components  (void)  const noexcept;
+        EXPORT  dimension_t get_dimension   (void)  const noexcept;
+
+        EXPORT  scalar_t distance   (const Rnpp_checked & other) const;
+        EXPORT  scalar_t inner      (const Rnpp_checked & other) const;
+};
+
+typedef Rnpp_checked <bfloat16_t>   Rnbpp_checked;
+typedef Rnpp_checked <double>       Rndpp_checked;
+typedef Rnpp_checked <float>        Rnfpp_checked;
+typedef Rnpp_checked <half_t>       Rnhpp_checked;
+
+
+
+/**
+ * \brief   A vector shared between its copies until it is modified.
+ *
+ * This class holds a vector by an atomically reference counted pointer.  Its
+ * copies share the vector, such that copying costs a single increment of the
+ * reference count regardless of the dimension.  The shared vector is immutable:
+ * `get_vector` grants read access only while `mutate` clones the vector once in
+ * case it is still shared and applies a given modification to the clone.
+ * Hence, a pipeline passing a vector read-only through many stages never copies
+ * it.  The components must not be modified through the reference returned by
+ * `get_vector` since this would affect all copies.  Write access is scoped to
+ * the modification passed to `mutate`, such that it cannot outlast the check
+ * whether the vector is still shared.  The norm is computed once and cached
+ * for all copies; `mutate` invalidates it.
+ *
+ * Distinct objects sharing the same vector can be used, copied and destroyed
+ * by different threads concurrently.  A single object must not be used by
+ * several threads at once if one of them calls `mutate`.
+ */
+
+template <typename T>
+class Rnpp_shared
+{
+    public:
+        typedef typename Rnpp_traits <T> :: scalar_t scalar_t;
+
+    private:
+        shared_ptr <atomic <scalar_t> > cached;
+        shared_ptr <Rnpp <T> >          rnpp;
+
+    public:
+        EXPORT  Rnpp_shared (void);
+        EXPORT  Rnpp_shared (const Rnpp <T> &   rnpp);
+        EXPORT  Rnpp_shared (Rnpp <T> &&        rnpp);
+
+        EXPORT  dimension_t         get_dimension   (void) const noexcept;
+        EXPORT  dimension_t         get_references  (void) const noexcept;
+        EXPORT  const Rnpp <T> &    get_vector      (void) const noexcept;
+
+        EXPORT  scalar_t    cosine  (const Rnpp_shared & other) const;
+        EXPORT  scalar_t    norm    (void) const noexcept;
+
+        EXPORT  void mutate (const function <void (Rnpp <T> &)> & mutation);
+};
+
+typedef Rnpp_shared <bfloat16_t>    Rnbpp_shared;
+typedef Rnpp_shared <double>        Rndpp_shared;
+typedef Rnpp_shared <float>         Rnfpp_shared;
+typedef Rnpp_shared <half_t>        Rnhpp_shared;
+
+
+
+/**
+ * \brief   The hash of a vector for unordered containers.
+ *
+ * This specialisation hashes the canonicalised components such that vectors
+ * which compare equal share their hash.  Vectors containing NaN should not be
+ * used as keys since NaN compares equal to any number.
+ */
+
+namespace std
+{
+    template <typename T>
+    struct hash <Rnpp <T> >
+    {
+        size_t operator () (const Rnpp <T> & rnpp) const noexcept
+        {
+            return size_t (rnpp.hash (true));
+        }
+    };
+}
+
+
+
+/**
+ * \brief   The granularity of a scalar quantisation.
+ *
+ * A quantised batch shares its scales and offsets either between all rows for
+ * each dimension or between all components of each row.
+ */
+
+enum quantisation_t
+{
+    Rnpp_per_dimension,
+    Rnpp_per_vector
+};
+
+
+
+/**
+ * \brief   A batch of vectors quantised to 8 bit integers.
+ *
+ * This class approximates each component `x` of a batch by
+ * `offset + scale * code` with an integral `code` in [-127, 127], reducing the
+ * memory per component to a single byte.  Inner products and distances to a
+ * query are approximated by integer inner products of the codes with a
+ * quantised query.  The name derives from "real vectors of n quantised
+ * components, written in C++".
+ */
+
+class Rnqpp_batch
+{
+    private:
+        vector <int8_t> codes;
+        dimension_t     count;
+        dimension_t     dimension;
+        fvec_t          norms;
+        fvec_t          offsets;
+        quantisation_t  quantisation;
+        fvec_t          scales;
+
+        void quantise_query (const Rnfpp &      query,
+                             vector <int8_t> &  codes,
+                             float &            scale,
+                             float &            offset) const;
+
+    public:
+        EXPORT  Rnqpp_batch     (void);
+        EXPORT  Rnqpp_batch     (const Rnfpp_batch &    batch,
+                                 const quantisation_t   quantisation);
+
+        EXPORT  ~Rnqpp_batch    (void);
+
+        EXPORT  const vector <int8_t> & get_codes        (void) const noexcept;
+        EXPORT  dimension_t             get_count        (void) const noexcept;
+        EXPORT  dimension_t             get_dimension    (void) const noexcept;
+        EXPORT  const fvec_t &          get_offsets      (void) const noexcept;
+        EXPORT  quantisation_t          get_quantisation (void) const noexcept;
+        EXPORT  const fvec_t &          get_scales       (void) const noexcept;
+
+        EXPORT  Rnfpp_batch dequantise  (void)                      const;
+        EXPORT  Rnfpp       get_row     (const dimension_t index)   const;
+
         EXPORT  void assert_range           (const dimension_t  index)  const;
-        EXPORT  void assert_same_dimension  (const fvec_t &     other)  const;
         EXPORT  void assert_same_dimension  (const Rnfpp &      other)  const;
 
-        EXPORT  void    affinise        (void);
-        EXPORT  float   distance        (const fvec_t & other)  const;
-        EXPORT  float   distance        (const Rnfpp &  other)  const;
-        EXPORT  void    homogenise      (void);
-        EXPORT  float   inner           (const fvec_t & other)  const;
-        EXPORT  float   inner           (const Rnfpp &  other)  const;
-        EXPORT  float   norm            (void)                  const noexcept;
-        EXPORT  void    normalise       (void);
-        EXPORT  Rnfpp   outer           (const fvec_t & other)  const;
-        EXPORT  Rnfpp   outer           (const Rnfpp & other)   const;
-        EXPORT  bool    same_dimension  (const fvec_t & other)  const noexcept;
-        EXPORT  bool    same_dimension  (const Rnfpp &  other)  const noexcept;
+        EXPORT  fvec_t  distance    (const Rnfpp &  query)  const;
+        EXPORT  fvec_t  inner       (const Rnfpp &  query)  const;
+};
+
+
+
+/**
+ * \brief   A locality-sensitive hash family for the angle between vectors.
+ *
+ * This class projects vectors onto up to 64 random hyperplanes drawn from a
+ * standard normal distribution and quantises each projection to its sign.  The
+ * signs form the bits of a signature, known as SimHash.  The probability of two
+ * vectors to differ in a bit is their angle divided by pi; hence, the Hamming
+ * distance of two signatures estimates the angle of the vectors and equal
+ * signatures or equal bands of them serve as buckets.  The hyperplanes only
+ * depend on the dimension, the number of bits and the seed.
+ */
+
+class Rnpp_simhash
+{
+    private:
+        dimension_t bits;
+        dimension_t dimension;
+        fvec_t      planes;
+
+    public:
+        EXPORT  Rnpp_simhash    (void);
+        EXPORT  Rnpp_simhash    (const dimension_t  dimension,
+                                 const dimension_t  bits,
+                                 const uint64_t     seed);
+
+        EXPORT  ~Rnpp_simhash   (void);
+
+        EXPORT  dimension_t     get_bits        (void)  const noexcept;
+        EXPORT  dimension_t     get_dimension   (void)  const noexcept;
+        EXPORT  const fvec_t &  get_planes      (void)  const noexcept;
+
+        EXPORT  void assert_same_dimension  (const dimension_t  dimension)
+                                            const;
+
+        EXPORT  static dimension_t hamming  (const uint64_t a,
+                                             const uint64_t b) noexcept;
+
+        template <typename T>
+        EXPORT  uint64_t            signature (const Rnpp <T> &        rnpp)
+                                              const;
+
+        template <typename T>
+        EXPORT  vector <uint64_t>   signature (const Rnpp_batch <T> &  batch)
+                                              const;
+};
+
+
+
+/**
+ * \brief   A k-means clustering of vector batches.
+ *
+ * This class partitions the rows of a batch into a fixed number of clusters
+ * such that the sum of the squared distances of the rows to the centroids of
+ * their clusters, the inertia, becomes small.  The centroids are seeded by
+ * k-means++ and refined either by Lloyd's algorithm on the whole batch or by
+ * mini-batch updates on random samples.  The distances are computed panel-wise
+ * from inner products like a matrix product does and both the assignment and
+ * the update of the centroids are distributed across several threads.  The
+ * duration of each iteration is recorded.
+ */
+
+class Rnpp_kmeans
+{
+    private:
+        fvec_t          centroids;
+        dimension_t     clusters;
+        dimension_t     dimension;
+        double          inertia;
+        uint64_t        seed;
+        dimension_t     threads;
+        vector <double> timings;
+
+        void    initialise  (const Rnfpp_batch &    batch,
+                             uint64_t &             state);
+        double  nearest     (const float *          rows,
+                             const dimension_t      count,
+                             dimension_t *          labels,
+                             float *                distances)  const;
+
+    public:
+        EXPORT  Rnpp_kmeans     (void);
+        EXPORT  Rnpp_kmeans     (const dimension_t  clusters,
+                                 const uint64_t     seed);
+
+        EXPORT  ~Rnpp_kmeans    (void);
+
+        EXPORT  const fvec_t &          get_centroids   (void) const noexcept;
+        EXPORT  dimension_t             get_clusters    (void) const noexcept;
+        EXPORT  dimension_t             get_dimension   (void) const noexcept;
+        EXPORT  double                  get_inertia     (void) const noexcept;
+        EXPORT  dimension_t             get_threads     (void) const noexcept;
+        EXPORT  const vector <double> & get_timings     (void) const noexcept;
+
+        EXPORT  void set_threads (const dimension_t threads) noexcept;
+
+        EXPORT  void assert_fit             (const Rnfpp_batch &    batch)
+                                            const;
+        EXPORT  void assert_same_dimension  (const Rnfpp_batch &    batch)
+                                            const;
+
+        EXPORT  vector <dimension_t> assign (const Rnfpp_batch & batch) const;
+
+        EXPORT  void fit            (const Rnfpp_batch &    batch,
+                                     const dimension_t      iterations,
+                                     const float            tolerance);
+        EXPORT  void fit_mini_batch (const Rnfpp_batch &    batch,
+                                     const dimension_t      iterations,
+                                     const dimension_t      size);
+};
+
+
+
+/**
+ * \brief   The kind of a linear dimensionality reduction.
+ *
+ * A projection is either drawn at random, with dense normally distributed or
+ * with very sparse ternary entries, or fitted to the principal components of a
+ * batch.
+ */
+
+enum projection_t
+{
+    Rnpp_gaussian,
+    Rnpp_principal,
+    Rnpp_sparse
+};
+
+
+
+/**
+ * \brief   A linear dimensionality reduction of vector batches.
+ *
+ * This class maps vectors of an input dimension linearly onto vectors of a
+ * usually much lower output dimension.  Random projections approximately
+ * preserve the distances of any set of vectors, as stated by the lemma of
+ * Johnson and Lindenstrauss, without being fitted.  The principal components
+ * of a batch preserve as much of its variance as possible; they are obtained
+ * from the covariance matrix by subspace iteration.  A batch is transformed in
+ * a single pass which is distributed across several threads.  The projection
+ * can be saved to and restored from a binary stream.
+ */
+
+class Rnpp_projection
+{
+    private:
+        fvec_t          biases;
+        dimension_t     input;
+        fvec_t          matrix;
+        fvec_t          mean;
+        dimension_t     output;
+        projection_t    projection;
+        dimension_t     threads;
+        fvec_t          variances;
+
+        void prepare_biases (void);
+
+    public:
+        EXPORT  Rnpp_projection     (void);
+        EXPORT  Rnpp_projection     (const dimension_t      input,
+                                     const dimension_t      output,
+                                     const projection_t     projection,
+                                     const uint64_t         seed);
+        EXPORT  Rnpp_projection     (const Rnfpp_batch &    batch,
+                                     const dimension_t      output,
+                                     const uint64_t         seed);
+        EXPORT  explicit Rnpp_projection (istream & stream);
+
+        EXPORT  ~Rnpp_projection    (void);
+
+        EXPORT  dimension_t     get_input       (void) const noexcept;
+        EXPORT  const fvec_t &  get_matrix      (void) const noexcept;
+        EXPORT  const fvec_t &  get_mean        (void) const noexcept;
+        EXPORT  dimension_t     get_output      (void) const noexcept;
+        EXPORT  projection_t    get_projection  (void) const noexcept;
+        EXPORT  dimension_t     get_threads     (void) const noexcept;
+        EXPORT  const fvec_t &  get_variances   (void) const noexcept;
+
+        EXPORT  void set_threads (const dimension_t threads) noexcept;
+
+        EXPORT  void assert_same_dimension  (const dimension_t  dimension)
+                                            const;
+
+        EXPORT  void        save        (ostream &              stream) const;
+        EXPORT  Rnfpp       transform   (const Rnfpp &          rnpp)   const;
+        EXPORT  Rnfpp_batch transform   (const Rnfpp_batch &    batch)  const;
 };
 
 
 
+/**
+ * \brief   Statistics of the rows of vector batches.
+ *
+ * This class accumulates the number of rows as well as the mean, the variance,
+ * the minimum and the maximum of each dimension and optionally the covariance
+ * matrix in a single pass.  The rows are processed in panels:  the moments of
+ * each panel are computed about its own mean and merged into the running ones
+ * by the pairwise update of Chan, Golub and LeVeque, which generalises the one
+ * of Welford and is numerically stable.  Statistics of several batches or of
+ * several parts of a batch can be merged the same way.
+ */
+
+class Rnpp_statistics
+{
+    private:
+        vector <double> comoments;
+        dimension_t     count;
+        dimension_t     dimension;
+        vector <double> maximum;
+        vector <double> mean;
+        vector <double> minimum;
+        vector <double> moments;
+
+        template <typename S>
+        void accumulate (const S *          rows,
+                         const dimension_t  count,
+                         const dimension_t  threads,
+                         vector <S> &       panel,
+                         vector <S> &       products,
+                         vector <double> &  scratch);
+
+    public:
+        EXPORT  Rnpp_statistics     (void);
+        EXPORT  Rnpp_statistics     (const dimension_t  dimension,
+                                     const bool         covariance);
+
+        EXPORT  ~Rnpp_statistics    (void);
+
+        EXPORT  dimension_t             get_count       (void) const noexcept;
+        EXPORT  dimension_t             get_dimension   (void) const noexcept;
+        EXPORT  const vector <double> & get_maximum     (void) const noexcept;
+        EXPORT  const vector <double> & get_mean        (void) const noexcept;
+        EXPORT  const vector <double> & get_minimum     (void) const noexcept;
+
+        EXPORT  void assert_same_dimension  (const dimension_t  dimension)
+                                            const;
+
+        EXPORT  vector <double> covariance  (const bool sample) const;
+        EXPORT  vector <double> variance    (const bool sample) const;
+
+        EXPORT  void merge  (const Rnpp_statistics &    other);
+
+        template <typename T>
+        EXPORT  void update (const Rnpp_batch <T> &     batch,
+                             const dimension_t          threads);
+};
+
+
+
+/**
+ * \brief   A sparse vector of `float` components.
+ *
+ * This class stores only the non-zero components of a vector as pairs of an
+ * index and a value, sorted by their indices.  Calculations with another
+ * sparse vector merge both lists of indices; calculations with a dense vector
+ * gather from or scatter into its components.  Hence, their costs depend on
+ * the number of non-zero components rather than on the dimension.  The name
+ * derives from "real vector of n sparse components, written in C++".
+ */
+
+class Rnspp
+{
+    private:
+        dimension_t         dimension;
+        vector <uint32_t>   indices;
+        fvec_t              values;
+
+    public:
+        EXPORT  Rnspp   (void);
+        EXPORT  Rnspp   (const dimension_t          dimension);
+        EXPORT  Rnspp   (const dimension_t          dimension,
+                         const vector <uint32_t> &  indices,
+                         const fvec_t &             values);
+
+        EXPORT  explicit Rnspp (const Rnfpp & dense);
+
+        EXPORT  ~Rnspp  (void);
+
+        EXPORT  dimension_t                 get_dimension   (void)
+                                                            const noexcept;
+        EXPORT  const vector <uint32_t> &   get_indices     (void)
+                                                            const noexcept;
+        EXPORT  dimension_t                 get_non_zeros   (void)
+                                                            const noexcept;
+        EXPORT  const fvec_t &              get_values      (void)
+                                                            const noexcept;
+
+        EXPORT  float   operator [] (const dimension_t index) const;
+
+        EXPORT  void assert_range           (const dimension_t  index)  const;
+        EXPORT  void assert_same_dimension  (const dimension_t  other)  const;
+
+        EXPORT  void    axpy        (const float    alpha,
+                                     const Rnspp &  x);
+        EXPORT  Rnfpp   dense       (void)                  const;
+        EXPORT  float   distance    (const Rnfpp &  other)  const;
+        EXPORT  float   distance    (const Rnspp &  other)  const;
+        EXPORT  float   inner       (const Rnfpp &  other)  const;
+        EXPORT  float   inner       (const Rnspp &  other)  const;
+        EXPORT  float   norm        (void)                  const noexcept;
+        EXPORT  void    scatter     (const float    alpha,
+                                     Rnfpp &        y)      const;
+};
+
+
+
+/**
+ * \brief   A pool of threads executing batch operations asynchronously.
+ *
+ * This class runs tasks on a fixed number of dedicated threads and returns a
+ * `std :: future` for each of them.  The tasks wait in a queue of a bounded
+ * capacity:  submitting to a full queue blocks the caller until a worker takes
+ * the next task whereas `try_submit` returns an invalid future instead.  Hence,
+ * the submitting threads cannot outpace the workers.  An exception thrown by a
+ * task is rethrown by the `get` method of its future.  Tasks must not wait for
+ * other tasks of the same pool.  The destructor completes all queued tasks
+ * before it joins the workers.  On NUMA machines, the workers can be pinned to
+ * the nodes in contiguous groups.
+ */
+
+class Rnpp_pool
+{
+    private:
+        dimension_t                     capacity;
+        condition_variable              filled;
+        mutable mutex                   lock;
+        deque <function <void (void)> > queue;
+        condition_variable              space;
+        bool                            stopping;
+        vector <std :: thread>          workers;
+
+        EXPORT  void    push        (function <void (void)> &&  task);
+        EXPORT  bool    try_push    (function <void (void)> &&  task);
+        void            stop        (void);
+        void            work        (const bool                 pinned,
+                                     const dimension_t          node);
+
+    public:
+        EXPORT  Rnpp_pool   (const dimension_t  threads,
+                             const dimension_t  capacity,
+                             const bool         pinned);
+
+        EXPORT  ~Rnpp_pool  (void);
+
+        EXPORT  dimension_t get_capacity    (void) const noexcept;
+        EXPORT  dimension_t get_pending     (void) const;
+        EXPORT  dimension_t get_threads     (void) const noexcept;
+
+        template <typename F>
+        future <decltype (declval <F &> () ())> submit      (F task);
+        template <typename F>
+        future <decltype (declval <F &> () ())> try_submit  (F task);
+
+        EXPORT  future <vector <dimension_t> >  nearest
+            (const Rnfpp_batch &        batch,
+             const Rnfpp &              query,
+             const dimension_t          neighbours);
+        EXPORT  future <Rnfpp_batch>            normalise
+            (Rnfpp_batch                batch);
+        EXPORT  future <Rnfpp_batch>            transform
+            (const Rnpp_projection &    projection,
+             Rnfpp_batch                batch);
+};
+
+
+
+/**
+ * \brief   The storage of a concurrent vector store.
+ *
+ * This class is internal to the library.
+ */
+
+class kernel_store;
+
+
+
+/**
+ * \brief   A concurrent store of vectors for online insertions and queries.
+ *
+ * This class appends vectors of a fixed dimension from any number of threads
+ * while other threads read them, without a lock on either path.  The vectors
+ * are kept in segments of growing size which never move, such that appending a
+ * vector reserves its index by an atomic increment and copies the components.
+ * Readers take an `Rnpp_snapshot` which fixes the vectors and the erasures
+ * visible to it.  Erased vectors keep their index.  Clearing the store replaces
+ * its storage at once.  The replaced storage is freed by epoch-based
+ * reclamation during a later clearing once no snapshot refers to it any longer,
+ * and by the destructor at the latest.  Snapshots must not outlive their store.
+ */
+
+class Rnpp_store
+{
+    friend class Rnpp_snapshot;
+
+    private:
+        atomic <dimension_t>    active      [0x2];
+        dimension_t             chunk;
+        atomic <kernel_store *> current;
+        dimension_t             dimension;
+        atomic <uint64_t>       epoch;
+        mutex                   lock;
+        vector <kernel_store *> retired;
+        vector <uint64_t>       retirements;
+
+        void    reclaim (void);
+
+    public:
+        EXPORT  Rnpp_store  (const dimension_t  dimension,
+                             const dimension_t  chunk);
+
+        EXPORT  ~Rnpp_store (void);
+
+        EXPORT  dimension_t get_count       (void) const noexcept;
+        EXPORT  dimension_t get_dimension   (void) const noexcept;
+
+        EXPORT  void assert_same_dimension (const Rnfpp & row) const;
+
+        EXPORT  void        clear       (void);
+        EXPORT  bool        erase       (const dimension_t  index);
+        EXPORT  dimension_t push_back   (const Rnfpp &      row);
+};
+
+
+
+/**
+ * \brief   A consistent view of a concurrent vector store.
+ *
+ * This class fixes the number of vectors and of erasures of a store when it is
+ * created.  Vectors appended or erased afterwards do not affect it, such that
+ * all scans of a snapshot agree with each other.  The distances and the inner
+ * products of erased vectors are NaN.  As long as a snapshot exists, the
+ * storage it refers to is not freed, even if the store is cleared meanwhile.
+ */
+
+class Rnpp_snapshot
+{
+    friend class Rnpp_store;
+
+    private:
+        dimension_t     count;
+        kernel_store *  data;
+        uint64_t        epoch;
+        dimension_t     erasures;
+        Rnpp_store *    store;
+
+    public:
+        EXPORT  explicit Rnpp_snapshot  (Rnpp_store &       store);
+        EXPORT  Rnpp_snapshot           (Rnpp_snapshot &&   snapshot) noexcept;
+
+        EXPORT  ~Rnpp_snapshot  (void);
+
+        EXPORT  dimension_t get_count       (void) const noexcept;
+        EXPORT  dimension_t get_dimension   (void) const noexcept;
+
+        EXPORT  Rnfpp   get_row (const dimension_t index) const;
+
+        EXPORT  void assert_range           (const dimension_t  index)  const;
+        EXPORT  void assert_same_dimension  (const Rnfpp &      query)  const;
+
+        EXPORT  fvec_t  distance    (const Rnfpp &      query)  const;
+        EXPORT  bool    erased      (const dimension_t  index)  const;
+        EXPORT  fvec_t  inner       (const Rnfpp &      query)  const;
+};
+
+
+
+/**
+ * \brief   A compile-time sequence of indices.
+ *
+ * The sequence `0, 1, ..., N - 1` is deduced from `Rnpp_make_indices <N>` in
+ * order to expand operations on all components of a fixed-size vector into a
+ * single constant expression.
+ */
+
+template <dimension_t... I>
+struct Rnpp_indices
+{
+};
+
+template <dimension_t N, dimension_t... I>
+struct Rnpp_make_indices : Rnpp_make_indices <N - 0x1, N - 0x1, I...>
+{
+};
+
+template <dimension_t... I>
+struct Rnpp_make_indices <0x0, I...>
+{
+    typedef Rnpp_indices <I...> type;
+};
+
+
+
+/**
+ * \brief   A vector of a fixed dimension for constant expressions.
+ *
+ * This class holds its `N` components in place rather than on the heap.  All
+ * methods which do not modify the vector are `constexpr`, such that constant
+ * vectors like basis vectors, rotation axes or tables of directions can be
+ * computed by the compiler and stored in the binary.  Calculations at compile
+ * time are exact up to the rounding of each operation; the results do not
+ * depend on the instruction set.  The components are either `float` or
+ * `double`.
+ */
+
+template <typename T, dimension_t N>
+class Rnpp_fixed
+{
+    static_assert (is_floating_point <T> :: value,
+                   "The components need to be floating point numbers!");
+    static_assert (N > 0x0, "A fixed-size vector requires a dimension!");
+
+    private:
+        typedef typename Rnpp_make_indices <N> :: type indices_t;
+
+        T   components [N];
+
+        template <dimension_t... I>
+        constexpr Rnpp_fixed    add         (const Rnpp_fixed &         other,
+                                             const Rnpp_indices <I...>)
+                                                                const noexcept;
+        template <dimension_t... I>
+        constexpr Rnpp_fixed    divide      (const T                    other,
+                                             const Rnpp_indices <I...>)
+                                                                const noexcept;
+        constexpr bool          equal       (const Rnpp_fixed &         other,
+                                             const dimension_t          index)
+                                                                const noexcept;
+        constexpr T             get         (const dimension_t          index)
+                                                                const noexcept;
+        constexpr T             inner       (const Rnpp_fixed &         other,
+                                             const dimension_t          index)
+                                                                const noexcept;
+        template <dimension_t... I>
+        constexpr Rnpp_fixed    scale       (const T                    other,
+                                             const Rnpp_indices <I...>)
+                                                                const noexcept;
+        template <dimension_t... I>
+        constexpr Rnpp_fixed    subtract    (const Rnpp_fixed &         other,
+                                             const Rnpp_indices <I...>)
+                                                                const noexcept;
+
+    public:
+        constexpr Rnpp_fixed (void) noexcept;
+
+        template <typename... U>
+        constexpr explicit Rnpp_fixed (const T first, const U... rest) noexcept;
+
+        static constexpr dimension_t get_dimension (void) noexcept;
+
+        constexpr Rnpp_fixed    operator *  (const T            other)
+                                                                const noexcept;
+        constexpr Rnpp_fixed    operator +  (const Rnpp_fixed & other)
+                                                                const noexcept;
+        constexpr Rnpp_fixed    operator -  (void)              const noexcept;
+        constexpr Rnpp_fixed    operator -  (const Rnpp_fixed & other)
+                                                                const noexcept;
+        constexpr Rnpp_fixed    operator /  (const T            other)  const;
+        constexpr bool          operator == (const Rnpp_fixed & other)
+                                                                const noexcept;
+        constexpr bool          operator != (const Rnpp_fixed & other)
+                                                                const noexcept;
+        constexpr T             operator [] (const dimension_t  index)  const;
+
+        Rnpp_fixed &    operator *= (const T            other)  noexcept;
+        Rnpp_fixed &    operator += (const Rnpp_fixed & other)  noexcept;
+        Rnpp_fixed &    operator -= (const Rnpp_fixed & other)  noexcept;
+        Rnpp_fixed &    operator /= (const T            other);
+
+        constexpr T                     inner           (const Rnpp_fixed &
+                                                         other)
+                                                                const noexcept;
+        constexpr T                     norm_squared    (void)  const noexcept;
+        constexpr Rnpp_fixed <T, 0x3>   outer           (const Rnpp_fixed &
+                                                         other)
+                                                                const noexcept;
+
+        T           norm    (void) const noexcept;
+        Rnpp <T>    dynamic (void) const;
+};
+
+
+
+/**
+ * \brief   Abbreviations for the supported fixed-size vectors.
+ */
+
+template <dimension_t N>
+using Rndpp_fixed = Rnpp_fixed <double, N>;
+
+template <dimension_t N>
+using Rnfpp_fixed = Rnpp_fixed <float, N>;
+
+
+
+/**
+ * \brief   The operations counted by the instrumentation.
+ *
+ * Each operation covers all of its overloads and all component types.  The
+ * last entry is the number of operations.
+ */
+
+enum Rnpp_operation_t
+{
+    Rnpp_addition,
+    Rnpp_construction,
+    Rnpp_copy,
+    Rnpp_distance,
+    Rnpp_division,
+    Rnpp_inner,
+    Rnpp_multiplication,
+    Rnpp_normalise,
+    Rnpp_set_components,
+    Rnpp_subtraction,
+    Rnpp_operations
+};
+
+
+
+/**
+ * \brief   The counters of an operation.
+ *
+ * The counters sum up the calls of the operation, the components processed,
+ * the bytes allocated and the time spent in the operation, including the
+ * nested operations.  The out-of-place arithmetic operators count as a copy
+ * followed by the respective compound assignment.
+ */
+
+struct Rnpp_counters
+{
+    uint64_t    calls;
+    uint64_t    elements;
+    uint64_t    bytes;
+    uint64_t    nanoseconds;
+};
+
+
+
+/**
+ * \brief   Take a snapshot of the counters of all operations.
+ * \return  The counters, indexed by `Rnpp_operation_t`.
+ *
+ * The operations are only counted if the library is compiled with
+ * `__RNFPP_INSTRUMENT__` defined; otherwise, all counters remain zero and the
+ * operations do not pay for the instrumentation at all.
+ */
+
+EXPORT  vector <Rnpp_counters> Rnpp_profile (void);
+
+
+
+/**
+ * \brief   Write the counters of all operations as JSON.
+ * \param   stream  The stream to write the counters to.
+ * \throws  invalid_argument    In case the stream cannot be written.
+ *
+ * The counters are written as one object per operation, keyed by the name of
+ * the operation.
+ */
+
+EXPORT  void Rnpp_profile_json (ostream & stream);
+
+
+
+/**
+ * \brief   Reset the counters of all operations to zero.
+ */
+
+EXPORT  void Rnpp_profile_reset (void);
+
+
+
+/**
+ * \brief   Verify the optimised kernels against scalar reference versions.
+ * \param   seed    The seed of the random operands.
+ * \param   rounds  The number of rounds to run.
+ * \return  The number of failed comparisons.
+ *
+ * The kernels behind the arithmetic of all vector types are compiled for the
+ * instruction set of the target.  This function compares each of them with a
+ * plain scalar implementation across dimensions, misalignments and special
+ * values, such that a build can be checked before its vectorised paths are
+ * relied upon.  Builds with `__RNFPP_INSTRUMENT__` defined also check that the
+ * operations documented to be free of allocations do not allocate.
+ */
+
+EXPORT  dimension_t Rnpp_self_check (const uint64_t     seed,
+                                     const dimension_t  rounds);
+
+
+
+/*
+ * Inline definitions.
+ */
+
+/**
+ * \brief   Construct a new half_t object.
+ *
+ * This is the default constructor which will initialise the value with zero.
+ */
+
+inline half_t :: half_t (void) noexcept : bits (0x0)
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new half_t object from a `float`.
+ * \param   value   The value to round.
+ *
+ * This constructor rounds the given value to the nearest representable half
+ * precision number, ties to even.  Values beyond the range of the type will
+ * become infinite and NaNs will stay NaNs.
+ */
+
+inline half_t :: half_t (const float value) noexcept
+{
+    uint32_t x;
+    memcpy (& x, & value, sizeof (x));
+
+    const uint32_t sign = x & 0x80000000;
+    x ^= sign;
+
+    if (x >= 0x47800000)
+        this -> bits = x > 0x7f800000 ? 0x7e00 : 0x7c00;
+    else if (x < 0x38800000)
+    {
+        float       denormal;
+        uint32_t    result;
+        const float magic   = 0.5f;
+
+        memcpy (& denormal, & x, sizeof (denormal));
+        denormal += magic;
+        memcpy (& result, & denormal, sizeof (result));
+        this -> bits = result - 0x3f000000;
+    }
+    else
+        this -> bits = (x + 0xc8000fff + ((x >> 0xd) & 0x1)) >> 0xd;
+
+    this -> bits |= sign >> 0x10;
+    return;
+}
+
+
+
+/**
+ * \brief   Query the raw bits of this number.
+ * \return  The bit pattern.
+ *
+ * This method returns the IEEE 754 bit pattern of this number.
+ */
+
+inline uint16_t half_t :: get_bits (void) const noexcept
+{
+    return this -> bits;
+}
+
+
+
+/**
+ * \brief   Set the raw bits of this number.
+ * \param   bits    The bit pattern to hold.
+ *
+ * This method overwrites the IEEE 754 bit pattern of this number.
+ */
+
+inline void half_t :: set_bits (const uint16_t bits) noexcept
+{
+    this -> bits = bits;
+    return;
+}
+
+
+
+/**
+ * \brief   Convert this number to `float`.
+ * \return  The exact `float` representation.
+ *
+ * Every half precision number can be represented exactly by a `float`, hence,
+ * this conversion is lossless.
+ */
+
+inline half_t :: operator float (void) const noexcept
+{
+    uint32_t    x           = (this -> bits & 0x7fff) << 0xd;
+    float       ret;
+    const float magic       = 6.103515625e-05f;
+    uint32_t    exponent    = x & 0x0f800000;
+
+    x += 0x38000000;
+
+    if (exponent == 0x0f800000)
+        x += 0x38000000;
+    else if (! exponent)
+    {
+        x += 0x00800000;
+        memcpy (& ret, & x, sizeof (ret));
+        ret -= magic;
+        memcpy (& x, & ret, sizeof (x));
+    };
+
+    x |= (this -> bits & 0x8000) << 0x10;
+    memcpy (& ret, & x, sizeof (ret));
+    return ret;
+}
+
+
+
+/**
+ * \brief   Construct a new bfloat16_t object.
+ *
+ * This is the default constructor which will initialise the value with zero.
+ */
+
+inline bfloat16_t :: bfloat16_t (void) noexcept : bits (0x0)
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new bfloat16_t object from a `float`.
+ * \param   value   The value to round.
+ *
+ * This constructor rounds the given value to the nearest representable
+ * bfloat16 number, ties to even.  NaNs will stay quiet NaNs.
+ */
+
+inline bfloat16_t :: bfloat16_t (const float value) noexcept
+{
+    uint32_t x;
+    memcpy (& x, & value, sizeof (x));
+
+    if ((x & 0x7fffffff) > 0x7f800000)
+        this -> bits = (x >> 0x10) | 0x40;
+    else
+        this -> bits = (x + 0x7fff + ((x >> 0x10) & 0x1)) >> 0x10;
+
+    return;
+}
+
+
+
+/**
+ * \brief   Query the raw bits of this number.
+ * \return  The bit pattern.
+ *
+ * This method returns the upper 16 bits of the equivalent `float`.
+ */
+
+inline uint16_t bfloat16_t :: get_bits (void) const noexcept
+{
+    return this -> bits;
+}
+
+
+
+/**
+ * \brief   Set the raw bits of this number.
+ * \param   bits    The bit pattern to hold.
+ *
+ * This method overwrites the upper 16 bits of the equivalent `float`.
+ */
+
+inline void bfloat16_t :: set_bits (const uint16_t bits) noexcept
+{
+    this -> bits = bits;
+    return;
+}
+
+
+
+/**
+ * \brief   Convert this number to `float`.
+ * \return  The exact `float` representation.
+ *
+ * A bfloat16 number is the upper half of a `float`, hence, this conversion is
+ * lossless.
+ */
+
+inline bfloat16_t :: operator float (void) const noexcept
+{
+    const uint32_t  x   = uint32_t (this -> bits) << 0x10;
+    float           ret;
+
+    memcpy (& ret, & x, sizeof (ret));
+    return ret;
+}
+
+
+
+/**
+ * \brief   Add two fixed-size vectors component by component.
+ * \param   other   The vector to add.
+ * \return  The sum vector.
+ *
+ * The index sequence expands the sum of all components into the arguments of a
+ * single constructor call.
+ */
+
+template <typename T, dimension_t N>
+template <dimension_t... I>
+constexpr Rnpp_fixed <T, N> Rnpp_fixed <T, N> :: add
+    (const Rnpp_fixed & other, const Rnpp_indices <I...>) const noexcept
+{
+    return Rnpp_fixed ((this -> components[I] + other.components[I])...);
+}
+
+
+
+/**
+ * \brief   Divide a fixed-size vector by a scalar component by component.
+ * \param   other   The divisor.
+ * \return  The quotient vector.
+ */
+
+template <typename T, dimension_t N>
+template <dimension_t... I>
+constexpr Rnpp_fixed <T, N> Rnpp_fixed <T, N> :: divide
+    (const T other, const Rnpp_indices <I...>) const noexcept
+{
+    return Rnpp_fixed ((this -> components[I] / other)...);
+}
+
+
+
+/**
+ * \brief   Compare the remaining components of two fixed-size vectors.
+ * \param   other   The vector to compare with.
+ * \param   index   The first component to compare.
+ * \return  Whether all components from `index` on are equal.
+ */
+
+template <typename T, dimension_t N>
+constexpr bool Rnpp_fixed <T, N> :: equal (const Rnpp_fixed & other,
+                                           const dimension_t  index)
+    const noexcept
+{
+    return index == N || (this -> components[index] == other.components[index]
+                          && this -> equal (other, index + 0x1));
+}
+
+
+
+/**
+ * \brief   Query a component or zero beyond the dimension.
+ * \param   index   The component to query.
+ * \return  The component or zero.
+ */
+
+template <typename T, dimension_t N>
+constexpr T Rnpp_fixed <T, N> :: get (const dimension_t index) const noexcept
+{
+    return index < N ? this -> components[index] : T (0x0);
+}
+
+
+
+/**
+ * \brief   The inner product of the remaining components.
+ * \param   other   The vector to multiply with.
+ * \param   index   The first component to multiply.
+ * \return  The sum of the products from `index` on.
+ */
+
+template <typename T, dimension_t N>
+constexpr T Rnpp_fixed <T, N> :: inner (const Rnpp_fixed & other,
+                                        const dimension_t  index)
+    const noexcept
+{
+    return index == N ? T (0x0)
+                      : this -> components[index] * other.components[index]
+                        + this -> inner (other, index + 0x1);
+}
+
+
+
+/**
+ * \brief   Multiply a fixed-size vector by a scalar component by component.
+ * \param   other   The factor.
+ * \return  The scaled vector.
+ */
+
+template <typename T, dimension_t N>
+template <dimension_t... I>
+constexpr Rnpp_fixed <T, N> Rnpp_fixed <T, N> :: scale
+    (const T other, const Rnpp_indices <I...>) const noexcept
+{
+    return Rnpp_fixed ((this -> components[I] * other)...);
+}
+
+
+
+/**
+ * \brief   Subtract two fixed-size vectors component by component.
+ * \param   other   The vector to subtract.
+ * \return  The difference vector.
+ */
+
+template <typename T, dimension_t N>
+template <dimension_t... I>
+constexpr Rnpp_fixed <T, N> Rnpp_fixed <T, N> :: subtract
+    (const Rnpp_fixed & other, const Rnpp_indices <I...>) const noexcept
+{
+    return Rnpp_fixed ((this -> components[I] - other.components[I])...);
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp_fixed object.
+ *
+ * This is the default constructor which will initialise all components with
+ * zero.
+ */
+
+template <typename T, dimension_t N>
+constexpr Rnpp_fixed <T, N> :: Rnpp_fixed (void) noexcept : components ()
+{
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp_fixed object from its components.
+ * \param   first   The first component.
+ * \param   rest    The remaining components.
+ *
+ * Exactly `N` components need to be given; this is checked at compile time.
+ */
+
+template <typename T, dimension_t N>
+template <typename... U>
+constexpr Rnpp_fixed <T, N> :: Rnpp_fixed (const T first, const U... rest)
+    noexcept : components {first, T (rest)...}
+{
+    static_assert (sizeof... (U) + 0x1 == N,
+                   "The number of components does not match the dimension!");
+}
+
+
+
+/**
+ * \brief   Query the dimension of this vector type.
+ * \return  The number of components.
+ */
+
+template <typename T, dimension_t N>
+constexpr dimension_t Rnpp_fixed <T, N> :: get_dimension (void) noexcept
+{
+    return N;
+}
+
+
+
+/**
+ * \brief   The multiplication operator.
+ * \param   other   The factor.
+ * \return  The scaled vector.
+ */
+
+template <typename T, dimension_t N>
+constexpr Rnpp_fixed <T, N> Rnpp_fixed <T, N> :: operator * (const T other)
+    const noexcept
+{
+    return this -> scale (other, indices_t ());
+}
+
+
+
+/**
+ * \brief   The addition operator.
+ * \param   other   The vector to add.
+ * \return  The sum vector.
+ */
+
+template <typename T, dimension_t N>
+constexpr Rnpp_fixed <T, N> Rnpp_fixed <T, N> :: operator +
+    (const Rnpp_fixed & other) const noexcept
+{
+    return this -> add (other, indices_t ());
+}
+
+
+
+/**
+ * \brief   The negation operator.
+ * \return  The negated vector.
+ */
+
+template <typename T, dimension_t N>
+constexpr Rnpp_fixed <T, N> Rnpp_fixed <T, N> :: operator - (void)
+    const noexcept
+{
+    return this -> scale (T (- 0x1), indices_t ());
+}
+
+
+
+/**
+ * \brief   The subtraction operator.
+ * \param   other   The vector to subtract.
+ * \return  The difference vector.
+ */
+
+template <typename T, dimension_t N>
+constexpr Rnpp_fixed <T, N> Rnpp_fixed <T, N> :: operator -
+    (const Rnpp_fixed & other) const noexcept
+{
+    return this -> subtract (other, indices_t ());
+}
+
+
+
+/**
+ * \brief   The division operator.
+ * \param   other   The divisor.
+ * \return  The quotient vector.
+ * \throws  invalid_argument    In case the scalar should be zero.
+ *
+ * A division by zero in a constant expression fails to compile.
+ */
+
+template <typename T, dimension_t N>
+constexpr Rnpp_fixed <T, N> Rnpp_fixed <T, N> :: operator / (const T other)
+    const
+{
+    return (other == T (0x0)
+            ? RNPP_VIOLATION (invalid_argument,
+                              "A value unequal to zero is required!")
+            : void ()),
+           this -> divide (other, indices_t ());
+}
+
+
+
+/**
+ * \brief   The equality operator.
+ * \param   other   The vector to compare with.
+ * \return  Whether all components are equal.
+ */
+
+template <typename T, dimension_t N>
+constexpr bool Rnpp_fixed <T, N> :: operator == (const Rnpp_fixed & other)
+    const noexcept
+{
+    return this -> equal (other, 0x0);
+}
+
+
+
+/**
+ * \brief   The inequality operator.
+ * \param   other   The vector to compare with.
+ * \return  Whether any component differs.
+ */
+
+template <typename T, dimension_t N>
+constexpr bool Rnpp_fixed <T, N> :: operator != (const Rnpp_fixed & other)
+    const noexcept
+{
+    return ! this -> equal (other, 0x0);
+}
+
+
+
+/**
+ * \brief   The index operator.
+ * \param   index   The index position to query.
+ * \return  The requested component.
+ * \throws  out_of_range    In case the given index position is invalid.
+ *
+ * An invalid index position in a constant expression fails to compile.
+ */
+
+template <typename T, dimension_t N>
+constexpr T Rnpp_fixed <T, N> :: operator [] (const dimension_t index) const
+{
+    return (index < N
+            ? void ()
+            : RNPP_VIOLATION (out_of_range,
+                              "This index position does not exist!")),
+           this -> components[index];
+}
+
+
+
+/**
+ * \brief   The multiplication operator.
+ * \param   other   The factor.
+ * \return  This vector.
+ */
+
+template <typename T, dimension_t N>
+inline Rnpp_fixed <T, N> & Rnpp_fixed <T, N> :: operator *= (const T other)
+    noexcept
+{
+    for (dimension_t i = 0x0; i < N; i++)
+        this -> components[i] *= other;
+
+    return (* this);
+}
+
+
+
+/**
+ * \brief   The addition operator.
+ * \param   other   The vector to add.
+ * \return  This vector.
+ */
+
+template <typename T, dimension_t N>
+inline Rnpp_fixed <T, N> & Rnpp_fixed <T, N> :: operator +=
+    (const Rnpp_fixed & other) noexcept
+{
+    for (dimension_t i = 0x0; i < N; i++)
+        this -> components[i] += other.components[i];
+
+    return (* this);
+}
+
+
+
+/**
+ * \brief   The subtraction operator.
+ * \param   other   The vector to subtract.
+ * \return  This vector.
+ */
+
+template <typename T, dimension_t N>
+inline Rnpp_fixed <T, N> & Rnpp_fixed <T, N> :: operator -=
+    (const Rnpp_fixed & other) noexcept
+{
+    for (dimension_t i = 0x0; i < N; i++)
+        this -> components[i] -= other.components[i];
+
+    return (* this);
+}
+
+
+
+/**
+ * \brief   The division operator.
+ * \param   other   The divisor.
+ * \return  This vector.
+ * \throws  invalid_argument    In case the scalar should be zero.
+ */
+
+template <typename T, dimension_t N>
+inline Rnpp_fixed <T, N> & Rnpp_fixed <T, N> :: operator /= (const T other)
+{
+    if (other == T (0x0))
+        RNPP_VIOLATION (invalid_argument,
+                        "A value unequal to zero is required!");
+
+    for (dimension_t i = 0x0; i < N; i++)
+        this -> components[i] /= other;
+
+    return (* this);
+}
+
+
+
+/**
+ * \brief   The inner product.
+ * \param   other   The vector to multiply with.
+ * \return  The inner product.
+ *
+ * The products are summed up from the last component to the first one.
+ */
+
+template <typename T, dimension_t N>
+constexpr T Rnpp_fixed <T, N> :: inner (const Rnpp_fixed & other)
+    const noexcept
+{
+    return this -> inner (other, 0x0);
+}
+
+
+
+/**
+ * \brief   The squared Euclidean 2-norm.
+ * \return  The inner product of this vector with itself.
+ *
+ * Unlike the norm itself, this does not require a square root and is
+ * therefore available in constant expressions.
+ */
+
+template <typename T, dimension_t N>
+constexpr T Rnpp_fixed <T, N> :: norm_squared (void) const noexcept
+{
+    return this -> inner ((* this), 0x0);
+}
+
+
+
+/**
+ * \brief   The outer product of two vectors.
+ * \param   other   The vector to calculate the outer product with.
+ * \return  The outer product.
+ *
+ * As for `Rnpp`, the outer product is defined for two or three dimensions; in
+ * two dimensions, only its third component is non-zero.  Other dimensions
+ * fail to compile.
+ */
+
+template <typename T, dimension_t N>
+constexpr Rnpp_fixed <T, 0x3> Rnpp_fixed <T, N> :: outer
+    (const Rnpp_fixed & other) const noexcept
+{
+    static_assert (N == 0x2 || N == 0x3,
+                   "The outer product requires dimension 2 or 3!");
+
+    return Rnpp_fixed <T, 0x3> (this -> get (0x1) * other.get (0x2)
+                                - this -> get (0x2) * other.get (0x1),
+                                this -> get (0x2) * other.get (0x0)
+                                - this -> get (0x0) * other.get (0x2),
+                                this -> get (0x0) * other.get (0x1)
+                                - this -> get (0x1) * other.get (0x0));
+}
+
+
+
+/**
+ * \brief   The Euclidean 2-norm.
+ * \return  The Euclidean 2-norm of this vector.
+ */
+
+template <typename T, dimension_t N>
+inline T Rnpp_fixed <T, N> :: norm (void) const noexcept
+{
+    return sqrt (this -> norm_squared ());
+}
+
+
+
+/**
+ * \brief   Convert this vector into a vector of a dynamic dimension.
+ * \return  The equivalent `Rnpp` vector.
+ */
+
+template <typename T, dimension_t N>
+inline Rnpp <T> Rnpp_fixed <T, N> :: dynamic (void) const
+{
+    return Rnpp <T> (this -> components, N);
+}
+
+
+
+/**
+ * \brief   Submit a task to this pool.
+ * \param   task    The callable to execute without arguments.
+ * \return  The future of the result of the task.
+ *
+ * In case the queue is full, this method blocks until a worker takes the next
+ * task.
+ */
+
+template <typename F>
+inline future <decltype (declval <F &> () ())> Rnpp_pool :: submit (F task)
+{
+    typedef decltype (declval <F &> () ()) result_t;
+
+    const shared_ptr <packaged_task <result_t (void)> > packaged
+        = make_shared <packaged_task <result_t (void)> > (move (task));
+    future <result_t> ret = packaged -> get_future ();
+
+    this -> push ([packaged] (void) { (* packaged) (); });
+    return ret;
+}
+
+
+
+/**
+ * \brief   Submit a task to this pool unless its queue is full.
+ * \param   task    The callable to execute without arguments.
+ * \return  The future of the result of the task.
+ *
+ * In case the queue is full, this method returns an invalid future at once and
+ * the task is discarded.
+ */
+
+template <typename F>
+inline future <decltype (declval <F &> () ())> Rnpp_pool :: try_submit
+    (F task)
+{
+    typedef decltype (declval <F &> () ()) result_t;
+
+    const shared_ptr <packaged_task <result_t (void)> > packaged
+        = make_shared <packaged_task <result_t (void)> > (move (task));
+    future <result_t> ret = packaged -> get_future ();
+
+    if (! this -> try_push ([packaged] (void) { (* packaged) (); }))
+        return future <result_t> ();
+
+    return ret;
+}
+
+
+
 /*
  * End of header.
  */
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnfpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        absolute.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnfpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Determine the absolute values of this vector.
+ * \return  The vector of the absolute values.
+ *
+ * This method returns a new vector of the absolute values of the components of
+ * this vector.
+ * The sign bits are cleared.
+ */
+
+template <typename T>
+Rnpp <T> Rnpp <T> :: absolute (void) const
+{
+    Rnpp <T> ret = Rnpp <T> (this -> get_dimension ());
+
+    kernel_unary (kernel_absolute, this -> components.data (),
+                  ret.components.data (), this -> get_dimension ());
+    return ret;
+}
+
+
+
+/**
+ * \brief   Determine the absolute values of this vector.
+ * \return  This vector.
+ *
+ * This method replaces the components of this vector by their absolute values
+ * in a single pass.
+ */
+
+template <typename T>
+Rnpp <T> & Rnpp <T> :: absolute_inplace (void)
+{
+    kernel_unary (kernel_absolute, this -> components.data (),
+                  this -> components.data (), this -> get_dimension ());
+    return (* this);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp Rnbpp :: absolute (void) const;
+template Rnbpp & Rnbpp :: absolute_inplace (void);
+
+template Rndpp Rndpp :: absolute (void) const;
+template Rndpp & Rndpp :: absolute_inplace (void);
+
+template Rnfpp Rnfpp :: absolute (void) const;
+template Rnfpp & Rnfpp :: absolute_inplace (void);
+
+template Rnhpp Rnhpp :: absolute (void) const;
+template Rnhpp & Rnhpp :: absolute_inplace (void);
+
+/******************************************************************************/
@@ -42,21 +42,20 @@
 
 /**
  * \brief   The addition operator.
- * \param   other   The vector to add this one with.
+ * \param   other   The scalar to add to each component.
  * \return  The sum vector.
  *
- * This method returns the sum vector.
+ * This method returns the sum vector of this one and the given scalar, added to
+ * each component.
  */
 
-Rnfpp Rnfpp :: operator + (const float other) const noexcept
+template <typename T>
+Rnpp <T> Rnpp <T> :: operator + (const scalar_t other) const noexcept
 {
-    const float dimension   = this -> get_dimension ();
-    fvec_t      ret         = fvec_t (dimension);
-
-    for (dimension_t i = 0x0; i < dimension; i++)
-        ret.at (i) = other;
+    Rnpp <T> ret = (* this);
 
-    return (* this) + Rnfpp (other);
+    ret += other;
+    return ret;
 }
 
 
@@ -69,13 +68,17 @@ Rnfpp Rnfpp :: operator + (const float other) const noexcept
  *
  * This method returns the sum vector in case both input vectors, this and the
  * other one, share the same dimension.  In case they should be of different
- * dimensions, an according exception will be thrown.
+ * dimensions, an according exception will be thrown.  The dimensions are
+ * checked once by the compound assignment.
  */
 
-Rnfpp Rnfpp :: operator + (const fvec_t & other) const
+template <typename T>
+Rnpp <T> Rnpp <T> :: operator + (const vec_t & other) const
 {
-    this -> assert_same_dimension (other);
-    return (* this) + Rnfpp (other);
+    Rnpp <T> ret = (* this);
+
+    ret += other;
+    return ret;
 }
 
 
@@ -88,19 +91,39 @@ Rnfpp Rnfpp :: operator + (const fvec_t & other) const
  *
  * This method returns the sum vector in case both input vectors, this and the
  * other one, share the same dimension.  In case they should be of different
- * dimensions, an according exception will be thrown.
+ * dimensions, an according exception will be thrown.  The dimensions are
+ * checked once by the compound assignment.
  */
 
-Rnfpp Rnfpp :: operator + (const Rnfpp & other) const
+template <typename T>
+Rnpp <T> Rnpp <T> :: operator + (const Rnpp <T> & other) const
 {
-    this -> assert_same_dimension (other);
-
-    Rnfpp ret = Rnfpp (this -> get_dimension ());
-
-    for (dimension_t i = 0x0; i < this -> get_dimension (); i++)
-        ret[i] = (* this)[i] + other[i];
+    Rnpp <T> ret = (* this);
 
+    ret += other;
     return ret;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp Rnbpp :: operator + (const float) const noexcept;
+template Rnbpp Rnbpp :: operator + (const Rnbpp :: vec_t &) const;
+template Rnbpp Rnbpp :: operator + (const Rnbpp &) const;
+
+template Rndpp Rndpp :: operator + (const double) const noexcept;
+template Rndpp Rndpp :: operator + (const Rndpp :: vec_t &) const;
+template Rndpp Rndpp :: operator + (const Rndpp &) const;
+
+template Rnfpp Rnfpp :: operator + (const float) const noexcept;
+template Rnfpp Rnfpp :: operator + (const Rnfpp :: vec_t &) const;
+template Rnfpp Rnfpp :: operator + (const Rnfpp &) const;
+
+template Rnhpp Rnhpp :: operator + (const float) const noexcept;
+template Rnhpp Rnhpp :: operator + (const Rnhpp :: vec_t &) const;
+template Rnhpp Rnhpp :: operator + (const Rnhpp &) const;
+
 /******************************************************************************/
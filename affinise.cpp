@@ -43,16 +43,32 @@
 /**
  * \brief   Affinise this vector.
  *
- * This method affinises this vector.
+ * This method affinises this vector.  The components are updated in place
+ * without allocating memory.
  */
 
-void Rnfpp :: affinise (void)
+template <typename T>
+void Rnpp <T> :: affinise (void)
 {
     this -> assert_affinisation ();
-    const float scalar = (* this)[this -> get_dimension () - 0x1];
+    const scalar_t scalar = this -> components.back ();
     this -> components.pop_back ();
     (* this) /= scalar;
     return;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp :: affinise (void);
+
+template void Rndpp :: affinise (void);
+
+template void Rnfpp :: affinise (void);
+
+template void Rnhpp :: affinise (void);
+
 /******************************************************************************/
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnfpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        approx_equal.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnfpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Compare two vectors approximately.
+ * \param   other       The vector to compare this one with.
+ * \param   absolute    The absolute tolerance.
+ * \param   relative    The tolerance relative to the larger magnitude.
+ * \param   ulps        The tolerance in units in the last place.
+ * \return  Whether both vectors are close to each other.
+ *
+ * This method checks whether both vectors share the same dimension and whether
+ * each pair of components is close to each other.  Two components are close if
+ * their difference does not exceed the larger one of `absolute` and `relative`
+ * times the larger magnitude, or if they are at most `ulps` representable
+ * numbers apart.  NaN is never close to anything.  Components of a reduced
+ * precision are compared after their conversion to `float`.
+ */
+
+template <typename T>
+bool Rnpp <T> :: approx_equal (const vec_t &    other,
+                               const scalar_t   absolute,
+                               const scalar_t   relative,
+                               const uint32_t   ulps) const noexcept
+{
+    return this -> same_dimension (other)
+        && kernel_approx_equal (this -> components.data (), other.data (),
+                                this -> get_dimension (), absolute, relative,
+                                ulps);
+}
+
+
+
+/**
+ * \brief   Compare two vectors approximately.
+ * \param   other       The vector to compare this one with.
+ * \param   absolute    The absolute tolerance.
+ * \param   relative    The tolerance relative to the larger magnitude.
+ * \param   ulps        The tolerance in units in the last place.
+ * \return  Whether both vectors are close to each other.
+ *
+ * This method checks whether both vectors share the same dimension and whether
+ * each pair of components is close to each other.
+ */
+
+template <typename T>
+bool Rnpp <T> :: approx_equal (const Rnpp <T> & other,
+                               const scalar_t   absolute,
+                               const scalar_t   relative,
+                               const uint32_t   ulps) const noexcept
+{
+    return this -> approx_equal (other.components, absolute, relative, ulps);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template bool Rnbpp :: approx_equal (const Rnbpp :: vec_t &, const float,
+                                     const float, const uint32_t)
+                                     const noexcept;
+template bool Rnbpp :: approx_equal (const Rnbpp &, const float, const float,
+                                     const uint32_t) const noexcept;
+
+template bool Rndpp :: approx_equal (const Rndpp :: vec_t &, const double,
+                                     const double, const uint32_t)
+                                     const noexcept;
+template bool Rndpp :: approx_equal (const Rndpp &, const double, const double,
+                                     const uint32_t) const noexcept;
+
+template bool Rnfpp :: approx_equal (const Rnfpp :: vec_t &, const float,
+                                     const float, const uint32_t)
+                                     const noexcept;
+template bool Rnfpp :: approx_equal (const Rnfpp &, const float, const float,
+                                     const uint32_t) const noexcept;
+
+template bool Rnhpp :: approx_equal (const Rnhpp :: vec_t &, const float,
+                                     const float, const uint32_t)
+                                     const noexcept;
+template bool Rnhpp :: approx_equal (const Rnhpp &, const float, const float,
+                                     const uint32_t) const noexcept;
+
+/******************************************************************************/
@@ -48,15 +48,30 @@
  * exception will be thrown.
  */
 
-void Rnfpp :: assert_affinisation (void) const
+template <typename T>
+void Rnpp <T> :: assert_affinisation (void) const
 {
     const dimension_t dimension = this -> get_dimension ();
 
     if (dimension <= 0x1)
-        throw invalid_argument ("Too few components to affinise!");
+        RNPP_VIOLATION (invalid_argument, "Too few components to affinise!");
 
-    this -> assert_non_zero ((* this)[dimension - 0x1]);
+    this -> assert_non_zero (this -> components.back ());
     return;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp :: assert_affinisation (void) const;
+
+template void Rndpp :: assert_affinisation (void) const;
+
+template void Rnfpp :: assert_affinisation (void) const;
+
+template void Rnhpp :: assert_affinisation (void) const;
+
 /******************************************************************************/
@@ -49,12 +49,28 @@
  * be thrown.
  */
 
-void Rnfpp :: assert_non_zero (const float other) const
+template <typename T>
+void Rnpp <T> :: assert_non_zero (const scalar_t other) const
 {
     if (! abs (other))
-        throw invalid_argument ("A value unequal to zero is required!");
+        RNPP_VIOLATION (invalid_argument,
+                        "A value unequal to zero is required!");
 
     return;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp :: assert_non_zero (const float) const;
+
+template void Rndpp :: assert_non_zero (const double) const;
+
+template void Rnfpp :: assert_non_zero (const float) const;
+
+template void Rnhpp :: assert_non_zero (const float) const;
+
 /******************************************************************************/
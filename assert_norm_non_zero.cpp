@@ -48,10 +48,25 @@
  * will be thrown.
  */
 
-void Rnfpp :: assert_norm_non_zero (void) const
+template <typename T>
+void Rnpp <T> :: assert_norm_non_zero (void) const
 {
     this -> assert_non_zero (this -> norm ());
     return;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp :: assert_norm_non_zero (void) const;
+
+template void Rndpp :: assert_norm_non_zero (void) const;
+
+template void Rnfpp :: assert_norm_non_zero (void) const;
+
+template void Rnhpp :: assert_norm_non_zero (void) const;
+
 /******************************************************************************/
@@ -49,14 +49,16 @@
  * and the other one.  If not so, an exception will be thrown.
  */
 
-void Rnfpp :: assert_outer_product (const fvec_t & other) const
+template <typename T>
+void Rnpp <T> :: assert_outer_product (const vec_t & other) const
 {
     this -> assert_same_dimension (other);
 
     const dimension_t dimension = this -> get_dimension ();
 
     if (dimension != 0x2 && dimension != 0x3)
-        throw invalid_argument ("The outer product requires dimension 2 or 3!");
+        RNPP_VIOLATION (invalid_argument,
+                        "The outer product requires dimension 2 or 3!");
 
     return;
 }
@@ -72,16 +74,36 @@ void Rnfpp :: assert_outer_product (const fvec_t & other) const
  * and the other one.  If not so, an exception will be thrown.
  */
 
-void Rnfpp :: assert_outer_product (const Rnfpp & other) const
+template <typename T>
+void Rnpp <T> :: assert_outer_product (const Rnpp <T> & other) const
 {
     this -> assert_same_dimension (other);
 
     const dimension_t dimension = this -> get_dimension ();
 
     if (dimension != 0x2 && dimension != 0x3)
-        throw invalid_argument ("The outer product requires dimension 2 or 3!");
+        RNPP_VIOLATION (invalid_argument,
+                        "The outer product requires dimension 2 or 3!");
 
     return;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp :: assert_outer_product (const Rnbpp :: vec_t &) const;
+template void Rnbpp :: assert_outer_product (const Rnbpp &) const;
+
+template void Rndpp :: assert_outer_product (const Rndpp :: vec_t &) const;
+template void Rndpp :: assert_outer_product (const Rndpp &) const;
+
+template void Rnfpp :: assert_outer_product (const Rnfpp :: vec_t &) const;
+template void Rnfpp :: assert_outer_product (const Rnfpp &) const;
+
+template void Rnhpp :: assert_outer_product (const Rnhpp :: vec_t &) const;
+template void Rnhpp :: assert_outer_product (const Rnhpp &) const;
+
 /******************************************************************************/
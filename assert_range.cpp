@@ -49,12 +49,27 @@
  * position.  If not so, an according exception will be thrown.
  */
 
-void Rnfpp :: assert_range (const dimension_t index) const
+template <typename T>
+void Rnpp <T> :: assert_range (const dimension_t index) const
 {
     if (index >= this -> get_dimension ())
-        throw out_of_range ("This index position does not exist!");
+        RNPP_VIOLATION (out_of_range, "This index position does not exist!");
 
     return;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp :: assert_range (const dimension_t) const;
+
+template void Rndpp :: assert_range (const dimension_t) const;
+
+template void Rnfpp :: assert_range (const dimension_t) const;
+
+template void Rnhpp :: assert_range (const dimension_t) const;
+
 /******************************************************************************/
@@ -49,10 +49,12 @@
  * other one.  If not so, an exception will be thrown.
  */
 
-void Rnfpp :: assert_same_dimension (const fvec_t & other) const
+template <typename T>
+void Rnpp <T> :: assert_same_dimension (const vec_t & other) const
 {
     if (! this -> same_dimension (other))
-        throw invalid_argument ("The given vectors have different dimensions!");
+        RNPP_VIOLATION (invalid_argument,
+                        "The given vectors have different dimensions!");
 
     return;
 }
@@ -68,12 +70,39 @@ void Rnfpp :: assert_same_dimension (const fvec_t & other) const
  * other one.  If not so, an exception will be thrown.
  */
 
-void Rnfpp :: assert_same_dimension (const Rnfpp & other) const
+template <typename T>
+template <typename U, typename>
+void Rnpp <T> :: assert_same_dimension (const Rnpp <U> & other) const
 {
     if (! this -> same_dimension (other))
-        throw invalid_argument ("The given vectors have different dimensions!");
+        RNPP_VIOLATION (invalid_argument,
+                        "The given vectors have different dimensions!");
 
     return;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp :: assert_same_dimension (const Rnbpp :: vec_t &) const;
+template void Rnbpp :: assert_same_dimension (const Rnbpp &) const;
+template void Rnbpp :: assert_same_dimension (const Rnfpp &) const;
+template void Rnbpp :: assert_same_dimension (const Rnhpp &) const;
+
+template void Rndpp :: assert_same_dimension (const Rndpp :: vec_t &) const;
+template void Rndpp :: assert_same_dimension (const Rndpp &) const;
+
+template void Rnfpp :: assert_same_dimension (const Rnfpp :: vec_t &) const;
+template void Rnfpp :: assert_same_dimension (const Rnbpp &) const;
+template void Rnfpp :: assert_same_dimension (const Rnfpp &) const;
+template void Rnfpp :: assert_same_dimension (const Rnhpp &) const;
+
+template void Rnhpp :: assert_same_dimension (const Rnhpp :: vec_t &) const;
+template void Rnhpp :: assert_same_dimension (const Rnbpp &) const;
+template void Rnhpp :: assert_same_dimension (const Rnfpp &) const;
+template void Rnhpp :: assert_same_dimension (const Rnhpp &) const;
+
 /******************************************************************************/
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnfpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        axpby.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnfpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Combine another vector linearly with this one.
+ * \param   alpha   The factor of the other vector.
+ * \param   x       The other vector.
+ * \param   beta    The factor of this vector.
+ * \return  This vector.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method computes `this = alpha * x + beta * this` in place, without
+ * any temporary vector.  A fused multiply-add instruction is used if the
+ * target supports it.  Components of a reduced precision are calculated with
+ * in `float` and rounded to their storage type once.
+ */
+
+template <typename T>
+Rnpp <T> & Rnpp <T> :: axpby (const scalar_t    alpha,
+                              const Rnpp <T> &  x,
+                              const scalar_t    beta)
+{
+    this -> assert_same_dimension (x);
+    kernel_axpby (alpha, x.components.data (), beta,
+                  this -> components.data (), this -> get_dimension ());
+    return (* this);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp & Rnbpp :: axpby (const float, const Rnbpp &, const float);
+
+template Rndpp & Rndpp :: axpby (const double, const Rndpp &, const double);
+
+template Rnfpp & Rnfpp :: axpby (const float, const Rnfpp &, const float);
+
+template Rnhpp & Rnhpp :: axpby (const float, const Rnhpp &, const float);
+
+/******************************************************************************/
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnfpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        axpy.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnfpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Add a multiple of another vector to this one.
+ * \param   alpha   The factor of the other vector.
+ * \param   x       The other vector.
+ * \return  This vector.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method computes `this += alpha * x` in place.  Unlike
+ * `(* this) += x * alpha`, it neither builds a scaled copy of the other
+ * vector nor a sum vector.
+ */
+
+template <typename T>
+Rnpp <T> & Rnpp <T> :: axpy (const scalar_t alpha, const Rnpp <T> & x)
+{
+    return this -> axpby (alpha, x, scalar_t (0x1));
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp & Rnbpp :: axpy (const float, const Rnbpp &);
+
+template Rndpp & Rndpp :: axpy (const double, const Rndpp &);
+
+template Rnfpp & Rnfpp :: axpy (const float, const Rnfpp &);
+
+template Rnhpp & Rnhpp :: axpy (const float, const Rnhpp &);
+
+/******************************************************************************/
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Construct a new Rnpp_batch object.
+ *
+ * This is the default constructor which will prepare an empty batch.  The batch
+ * will adopt the dimension of the first row appended to it.
+ */
+
+template <typename T>
+Rnpp_batch <T> :: Rnpp_batch (void) : count (0x0), dimension (0x0)
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp_batch object.
+ * \param   count       The initial number of rows.
+ * \param   dimension   The dimension of the rows.
+ *
+ * This constructor will prepare a new batch of the given number of rows in one
+ * contiguous block of memory.  All components will be zero.
+ */
+
+template <typename T>
+Rnpp_batch <T> :: Rnpp_batch (const dimension_t count,
+                              const dimension_t dimension)
+    : components (count * dimension), count (count), dimension (dimension)
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp_batch object from raw components.
+ * \param   dimension   The dimension of the rows.
+ * \param   components  The components of all rows, one row after another.
+ * \throws  invalid_argument    In case the components form no complete rows.
+ *
+ * This constructor adopts the given components as they are, without splitting
+ * them into single vectors first.
+ */
+
+template <typename T>
+Rnpp_batch <T> :: Rnpp_batch (const dimension_t    dimension,
+                              const vector <T> &   components)
+    : components (components), count (0x0), dimension (dimension)
+{
+    if (dimension ? components.size () % dimension : ! components.empty ())
+        RNPP_VIOLATION (invalid_argument,
+                        "The components do not form complete rows!");
+
+    this -> count = dimension ? components.size () / dimension : 0x0;
+    return;
+}
+
+
+
+/**
+ * \brief   Destruct an Rnpp_batch object.
+ *
+ * This is the default destructor.
+ */
+
+template <typename T>
+Rnpp_batch <T> :: ~Rnpp_batch (void)
+{
+    return;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp_batch :: Rnpp_batch  (void);
+template Rnbpp_batch :: Rnpp_batch  (const dimension_t, const dimension_t);
+template Rnbpp_batch :: Rnpp_batch  (const dimension_t,
+                                     const vector <bfloat16_t> &);
+template Rnbpp_batch :: ~Rnpp_batch (void);
+
+template Rndpp_batch :: Rnpp_batch  (void);
+template Rndpp_batch :: Rnpp_batch  (const dimension_t, const dimension_t);
+template Rndpp_batch :: Rnpp_batch  (const dimension_t,
+                                     const vector <double> &);
+template Rndpp_batch :: ~Rnpp_batch (void);
+
+template Rnfpp_batch :: Rnpp_batch  (void);
+template Rnfpp_batch :: Rnpp_batch  (const dimension_t, const dimension_t);
+template Rnfpp_batch :: Rnpp_batch  (const dimension_t,
+                                     const vector <float> &);
+template Rnfpp_batch :: ~Rnpp_batch (void);
+
+template Rnhpp_batch :: Rnpp_batch  (void);
+template Rnhpp_batch :: Rnpp_batch  (const dimension_t, const dimension_t);
+template Rnhpp_batch :: Rnpp_batch  (const dimension_t,
+                                     const vector <half_t> &);
+template Rnhpp_batch :: ~Rnpp_batch (void);
+
+/******************************************************************************/
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_assert_range.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Ensure this batch to have sufficient rows to query.
+ * \param   index   The index to test against.
+ * \throws  out_of_range    In case the given row does not exist.
+ *
+ * This method tests whether this batch can be queried at the given row.  If not
+ * so, an according exception will be thrown.
+ */
+
+template <typename T>
+void Rnpp_batch <T> :: assert_range (const dimension_t index) const
+{
+    if (index >= this -> count)
+        RNPP_VIOLATION (out_of_range, "This row does not exist!");
+
+    return;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp_batch :: assert_range (const dimension_t) const;
+template void Rndpp_batch :: assert_range (const dimension_t) const;
+template void Rnfpp_batch :: assert_range (const dimension_t) const;
+template void Rnhpp_batch :: assert_range (const dimension_t) const;
+
+/******************************************************************************/
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_assert_same_dimension.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Ensure a vector to share the dimension of this batch.
+ * \param   other   The vector to test against.
+ * \throws  invalid_argument    In case the dimensions differ.
+ *
+ * This method tests whether the given vector is of the same dimension as the
+ * rows of this batch.  If not so, an exception will be thrown.
+ */
+
+template <typename T>
+void Rnpp_batch <T> :: assert_same_dimension (const row_t & other) const
+{
+    if (other.get_dimension () != this -> dimension)
+        RNPP_VIOLATION (invalid_argument,
+                        "The given vectors have different dimensions!");
+
+    return;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp_batch :: assert_same_dimension (const Rnfpp &) const;
+template void Rndpp_batch :: assert_same_dimension (const Rndpp &) const;
+template void Rnfpp_batch :: assert_same_dimension (const Rnfpp &) const;
+template void Rnhpp_batch :: assert_same_dimension (const Rnfpp &) const;
+
+/******************************************************************************/
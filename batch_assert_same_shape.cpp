@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_assert_same_shape.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Ensure a batch to share the shape of this batch.
+ * \param   other   The batch to test against.
+ * \throws  invalid_argument    In case the shapes differ.
+ *
+ * This method tests whether the given batch holds as many rows of the same
+ * dimension as this batch.  If not so, an exception will be thrown.
+ */
+
+template <typename T>
+void Rnpp_batch <T> :: assert_same_shape (const Rnpp_batch <T> & other) const
+{
+    if (other.count != this -> count || other.dimension != this -> dimension)
+        RNPP_VIOLATION (invalid_argument,
+                        "The given batches have different shapes!");
+
+    return;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp_batch :: assert_same_shape (const Rnbpp_batch &) const;
+template void Rndpp_batch :: assert_same_shape (const Rndpp_batch &) const;
+template void Rnfpp_batch :: assert_same_shape (const Rnfpp_batch &) const;
+template void Rnhpp_batch :: assert_same_shape (const Rnhpp_batch &) const;
+
+/******************************************************************************/
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_axpby.cpp
+ * 
+ote        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Combine another batch linearly with this one.
+ * \param   alpha   The factor of the other batch.
+ * \param   x       The other batch.
+ * \param   beta    The factor of this batch.
+ * \return  This batch.
+ * \throws  invalid_argument    In case the batches are of different shapes.
+ *
+ * This method computes `this = alpha * x + beta * this` for all rows at once.
+ * Since the rows are stored contiguously, the whole batch is updated by a
+ * single pass of the vector kernel.
+ */
+
+template <typename T>
+Rnpp_batch <T> & Rnpp_batch <T> :: axpby (const scalar_t         alpha,
+                                          const Rnpp_batch <T> & x,
+                                          const scalar_t         beta)
+{
+    this -> assert_same_shape (x);
+    kernel_axpby (alpha, x.components.data (), beta,
+                  this -> components.data (), this -> components.size ());
+    return (* this);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp_batch & Rnbpp_batch :: axpby (const float, const Rnbpp_batch &,
+                                             const float);
+template Rndpp_batch & Rndpp_batch :: axpby (const double, const Rndpp_batch &,
+                                             const double);
+template Rnfpp_batch & Rnfpp_batch :: axpby (const float, const Rnfpp_batch &,
+                                             const float);
+template Rnhpp_batch & Rnhpp_batch :: axpby (const float, const Rnhpp_batch &,
+                                             const float);
+
+/******************************************************************************/
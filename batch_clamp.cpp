@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_clamp.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Limit the components of this batch to an interval.
+ * \param   lower   The lower bound.
+ * \param   upper   The upper bound.
+ * \return  This batch.
+ * \throws  invalid_argument    In case the lower bound exceeds the upper one.
+ *
+ * This method limits the components of all rows to the interval between both
+ * bounds in a single pass, following `std :: clamp`.
+ */
+
+template <typename T>
+Rnpp_batch <T> & Rnpp_batch <T> :: clamp_inplace (const scalar_t lower,
+                                                  const scalar_t upper)
+{
+    if (upper < lower)
+        RNPP_VIOLATION (invalid_argument,
+                        "The lower bound exceeds the upper one!");
+
+    kernel_clamp (lower, upper, this -> components.data (),
+                  this -> components.data (), this -> components.size ());
+    return (* this);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp_batch & Rnbpp_batch :: clamp_inplace (const float, const float);
+template Rndpp_batch & Rndpp_batch :: clamp_inplace (const double,
+                                                     const double);
+template Rnfpp_batch & Rnfpp_batch :: clamp_inplace (const float, const float);
+template Rnhpp_batch & Rnhpp_batch :: clamp_inplace (const float, const float);
+
+/******************************************************************************/
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_cosine.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   The cosine similarities of all rows with a query vector.
+ * \param   query   The vector to compare with.
+ * \return  The cosine of each row, in order.
+ * \throws  invalid_argument    In case the dimensions differ.
+ *
+ * This method computes the norms of the rows on the fly.  See the overload
+ * below for queries against a fixed batch.
+ */
+
+template <typename T>
+typename Rnpp_batch <T> :: svec_t
+Rnpp_batch <T> :: cosine (const row_t & query) const
+{
+    return this -> cosine (query, this -> norms ());
+}
+
+
+
+/**
+ * \brief   The cosine similarities of all rows with a query vector.
+ * \param   query   The vector to compare with.
+ * \param   norms   The norms of the rows as computed by `norms`.
+ * \return  The cosine of each row, in order.
+ * \throws  invalid_argument    In case the dimensions or the counts differ.
+ *
+ * The norm of the query is computed once, such that each row costs a single
+ * inner product.  The cosine of a row of zero norm is NaN.
+ */
+
+template <typename T>
+typename Rnpp_batch <T> :: svec_t
+Rnpp_batch <T> :: cosine (const row_t & query, const svec_t & norms) const
+{
+    this -> assert_same_dimension (query);
+
+    if (norms.size () != this -> count)
+        RNPP_VIOLATION (invalid_argument,
+                        "The given norms do not match the rows!");
+
+    const scalar_t *    q       = query.get_components ().data ();
+    const scalar_t      length  = sqrt (kernel_inner (q, q, this -> dimension));
+    const T *           row     = this -> components.data ();
+    svec_t              ret     = svec_t (this -> count);
+
+    for (dimension_t i = 0x0; i < this -> count; i++, row += this -> dimension)
+        ret[i] = kernel_inner (row, q, this -> dimension) / (norms[i] * length);
+
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template fvec_t Rnbpp_batch :: cosine (const Rnfpp &) const;
+template fvec_t Rnbpp_batch :: cosine (const Rnfpp &, const fvec_t &) const;
+
+template vector <double> Rndpp_batch :: cosine (const Rndpp &) const;
+template vector <double> Rndpp_batch :: cosine (const Rndpp &,
+                                                const vector <double> &) const;
+
+template fvec_t Rnfpp_batch :: cosine (const Rnfpp &) const;
+template fvec_t Rnfpp_batch :: cosine (const Rnfpp &, const fvec_t &) const;
+
+template fvec_t Rnhpp_batch :: cosine (const Rnfpp &) const;
+template fvec_t Rnhpp_batch :: cosine (const Rnfpp &, const fvec_t &) const;
+
+/******************************************************************************/
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_distance.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   The distances of all rows to a query vector.
+ * \param   query   The vector to calculate the distances to.
+ * \return  The distance of each row, in order.
+ * \throws  invalid_argument    In case the dimensions differ.
+ *
+ * This method determines the Euclidean distance between each row of this batch
+ * and the given query.  The dimension is checked once for the whole batch.
+ * Components of a reduced precision are converted on the fly and accumulated in
+ * `float`.
+ */
+
+template <typename T>
+typename Rnpp_batch <T> :: svec_t
+Rnpp_batch <T> :: distance (const row_t & query) const
+{
+    this -> assert_same_dimension (query);
+
+    const scalar_t *    q   = query.get_components ().data ();
+    const T *           row = this -> components.data ();
+    svec_t              ret = svec_t (this -> count);
+
+    for (dimension_t i = 0x0; i < this -> count; i++, row += this -> dimension)
+        ret[i] = sqrt (kernel_distance_squared (row, q, this -> dimension));
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   The distances of the corresponding rows of two batches.
+ * \param   other   The other batch.
+ * \return  The distance of each pair of rows, in order.
+ * \throws  invalid_argument    In case the batches are of different shapes.
+ *
+ * This method determines the Euclidean distance between each row of this batch
+ * and the row of the other batch at the same position.  The shapes are checked
+ * once for all pairs; the kernels run without any further check.
+ */
+
+template <typename T>
+typename Rnpp_batch <T> :: svec_t
+Rnpp_batch <T> :: distance (const Rnpp_batch & other) const
+{
+    this -> assert_same_shape (other);
+
+    const T *   x   = this -> components.data ();
+    const T *   y   = other.components.data ();
+    svec_t      ret = svec_t (this -> count);
+
+    for (dimension_t i = 0x0; i < this -> count; i++)
+    {
+        ret[i] = sqrt (kernel_distance_squared (x, y, this -> dimension));
+        x += this -> dimension;
+        y += this -> dimension;
+    };
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   The distances of all rows to a query vector in parallel.
+ * \param   query   The vector to calculate the distances to.
+ * \param   threads The maximal number of threads to use.
+ * \return  The distance of each row, in order.
+ * \throws  invalid_argument    In case the dimensions differ.
+ *
+ * This method distributes the rows across several threads, zero selecting the
+ * number of hardware threads.  The ranges match the ones of `place` and each
+ * worker but the calling thread is pinned to the NUMA node of its range.
+ */
+
+template <typename T>
+typename Rnpp_batch <T> :: svec_t
+Rnpp_batch <T> :: distance (const row_t &      query,
+                            const dimension_t  threads) const
+{
+    this -> assert_same_dimension (query);
+
+    const dimension_t   workers = kernel_workers (this -> count, threads);
+    const scalar_t *    q       = query.get_components ().data ();
+    svec_t              ret     = svec_t (this -> count);
+
+    kernel_parallel_for (this -> count, workers, [&] (const dimension_t begin,
+                                                      const dimension_t end,
+                                                      const dimension_t worker)
+    {
+        const T * row = this -> components.data () + begin * this -> dimension;
+
+        if (worker)
+            kernel_numa_pin (kernel_numa_node (worker, workers));
+
+        for (dimension_t i = begin; i < end; i++, row += this -> dimension)
+            ret[i] = sqrt (kernel_distance_squared (row, q, this -> dimension));
+    });
+
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template fvec_t Rnbpp_batch :: distance (const Rnfpp &) const;
+template fvec_t Rnbpp_batch :: distance (const Rnfpp &,
+                                         const dimension_t) const;
+template fvec_t Rnbpp_batch :: distance (const Rnbpp_batch &) const;
+
+template vector <double> Rndpp_batch :: distance (const Rndpp &) const;
+template vector <double> Rndpp_batch :: distance (const Rndpp &,
+                                                  const dimension_t) const;
+template vector <double> Rndpp_batch :: distance (const Rndpp_batch &) const;
+
+template fvec_t Rnfpp_batch :: distance (const Rnfpp &) const;
+template fvec_t Rnfpp_batch :: distance (const Rnfpp &,
+                                         const dimension_t) const;
+template fvec_t Rnfpp_batch :: distance (const Rnfpp_batch &) const;
+
+template fvec_t Rnhpp_batch :: distance (const Rnfpp &) const;
+template fvec_t Rnhpp_batch :: distance (const Rnfpp &,
+                                         const dimension_t) const;
+template fvec_t Rnhpp_batch :: distance (const Rnhpp_batch &) const;
+
+/******************************************************************************/
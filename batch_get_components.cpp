@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_get_components.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Get the components object.
+ * \return  The requested components of this batch.
+ *
+ * The getter method for the components held by this batch.  The rows are
+ * stored one after another.
+ */
+
+template <typename T>
+const vector <T> & Rnpp_batch <T> :: get_components (void) const noexcept
+{
+    return this -> components;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template const vector <bfloat16_t> & Rnbpp_batch :: get_components (void)
+    const noexcept;
+
+template const vector <double> & Rndpp_batch :: get_components (void)
+    const noexcept;
+
+template const vector <float> & Rnfpp_batch :: get_components (void)
+    const noexcept;
+
+template const vector <half_t> & Rnhpp_batch :: get_components (void)
+    const noexcept;
+
+/******************************************************************************/
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_get_count.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Query the number of rows of this batch.
+ * \return  The requested number of rows.
+ *
+ * This method queries the number of vectors held by this batch.
+ */
+
+template <typename T>
+dimension_t Rnpp_batch <T> :: get_count (void) const noexcept
+{
+    return this -> count;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template dimension_t Rnbpp_batch :: get_count (void) const noexcept;
+template dimension_t Rndpp_batch :: get_count (void) const noexcept;
+template dimension_t Rnfpp_batch :: get_count (void) const noexcept;
+template dimension_t Rnhpp_batch :: get_count (void) const noexcept;
+
+/******************************************************************************/
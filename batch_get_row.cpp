@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_get_row.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Get a row of this batch.
+ * \param   index   The index of the row to query.
+ * \return  The requested row.
+ * \throws  out_of_range    In case the given row does not exist.
+ *
+ * This method copies the requested row out of this batch.  Components of a
+ * reduced precision are widened to `float`.
+ */
+
+template <typename T>
+typename Rnpp_batch <T> :: row_t
+Rnpp_batch <T> :: get_row (const dimension_t index) const
+{
+    this -> assert_range (index);
+
+    row_t ret = row_t (this -> dimension);
+
+    kernel_convert (this -> components.data () + index * this -> dimension,
+                    ret.get_components ().data (), this -> dimension);
+
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnfpp Rnbpp_batch :: get_row (const dimension_t) const;
+template Rndpp Rndpp_batch :: get_row (const dimension_t) const;
+template Rnfpp Rnfpp_batch :: get_row (const dimension_t) const;
+template Rnfpp Rnhpp_batch :: get_row (const dimension_t) const;
+
+/******************************************************************************/
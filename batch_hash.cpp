@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_hash.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   The content hashes of all rows.
+ * \param   canonical   Whether to canonicalise the components beforehand.
+ * \return  The hash of each row, in order.
+ *
+ * This method hashes each row of this batch like `Rnpp :: hash ()` does for a
+ * single vector; hence, a row and an equal vector share their hash.
+ */
+
+template <typename T>
+vector <uint64_t> Rnpp_batch <T> :: hash (const bool canonical) const
+{
+    const T *           row = this -> components.data ();
+    vector <uint64_t>   ret = vector <uint64_t> (this -> count);
+
+    for (dimension_t i = 0x0; i < this -> count; i++, row += this -> dimension)
+        ret[i] = canonical
+               ? kernel_hash_canonical (row, this -> dimension, 0x0)
+               : kernel_hash (row, this -> dimension * sizeof (T), 0x0);
+
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template vector <uint64_t> Rnbpp_batch :: hash (const bool) const;
+template vector <uint64_t> Rndpp_batch :: hash (const bool) const;
+template vector <uint64_t> Rnfpp_batch :: hash (const bool) const;
+template vector <uint64_t> Rnhpp_batch :: hash (const bool) const;
+
+/******************************************************************************/
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_householder.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Orthonormalise the rows by Householder reflections.
+ * \return  The triangular factor, row by row.
+ * \throws  invalid_argument    In case of more rows than components.
+ *
+ * This method computes the QR decomposition of the matrix whose columns are
+ * the rows of this batch.  The rows are replaced in place by the orthonormal
+ * factor and the `count * count` upper triangular factor is returned.  Hence,
+ * the former row `j` equals the sum of the returned element `[i * count + j]`
+ * times the new row `i` over all `i <= j`.  The diagonal of the triangular
+ * factor is non-negative.  Unlike the Gram-Schmidt process, the reflections
+ * keep the rows orthonormal up to the rounding error even for nearly
+ * dependent rows.
+ */
+
+template <typename T>
+typename Rnpp_batch <T> :: svec_t Rnpp_batch <T> :: householder (void)
+{
+    if (this -> count > this -> dimension)
+        RNPP_VIOLATION (invalid_argument,
+                        "There are more rows than components!");
+
+    svec_t ret = svec_t (this -> count * this -> count);
+
+    kernel_householder (this -> components.data (), this -> count,
+                        this -> dimension, ret.data ());
+
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template fvec_t Rnbpp_batch :: householder (void);
+template vector <double> Rndpp_batch :: householder (void);
+template fvec_t Rnfpp_batch :: householder (void);
+template fvec_t Rnhpp_batch :: householder (void);
+
+/******************************************************************************/
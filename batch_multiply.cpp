@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_multiply.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Multiply each row by a vector element by element.
+ * \param   other   The vector to combine each row with.
+ * \return  This batch.
+ * \throws  invalid_argument    In case of a different dimension.
+ *
+ * This method replaces the components of each row by their element-wise
+ * products with the components of the given vector, as required to scale
+ * features, for instance.
+ */
+
+template <typename T>
+Rnpp_batch <T> & Rnpp_batch <T> :: multiply_inplace (const row_t & other)
+{
+    this -> assert_same_dimension (other);
+
+    const scalar_t * y = other.get_components ().data ();
+
+    for (dimension_t i = 0x0; i < this -> count; i++)
+    {
+        T * row = this -> components.data () + i * this -> dimension;
+
+        kernel_binary (kernel_multiply, row, y, row, this -> dimension);
+    };
+
+    return (* this);
+}
+
+
+
+/**
+ * \brief   Multiply this batch by another batch element by element.
+ * \param   other   The other batch.
+ * \return  This batch.
+ * \throws  invalid_argument    In case the batches are of different shapes.
+ *
+ * This method replaces the components of this batch by their element-wise
+ * products with the components of the other batch in a single pass.
+ */
+
+template <typename T>
+Rnpp_batch <T> & Rnpp_batch <T> :: multiply_inplace (const Rnpp_batch & other)
+{
+    this -> assert_same_shape (other);
+    kernel_binary (kernel_multiply, this -> components.data (),
+                   other.components.data (), this -> components.data (),
+                   this -> components.size ());
+    return (* this);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp_batch & Rnbpp_batch :: multiply_inplace (const Rnfpp &);
+template Rnbpp_batch & Rnbpp_batch :: multiply_inplace (const Rnbpp_batch &);
+
+template Rndpp_batch & Rndpp_batch :: multiply_inplace (const Rndpp &);
+template Rndpp_batch & Rndpp_batch :: multiply_inplace (const Rndpp_batch &);
+
+template Rnfpp_batch & Rnfpp_batch :: multiply_inplace (const Rnfpp &);
+template Rnfpp_batch & Rnfpp_batch :: multiply_inplace (const Rnfpp_batch &);
+
+template Rnhpp_batch & Rnhpp_batch :: multiply_inplace (const Rnfpp &);
+template Rnhpp_batch & Rnhpp_batch :: multiply_inplace (const Rnhpp_batch &);
+
+/******************************************************************************/
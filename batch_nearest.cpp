@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_nearest.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: partial_sort;
+
+
+
+/**
+ * \brief   The rows nearest to a query vector.
+ * \param   query       The vector to search the neighbours of.
+ * \param   neighbours  The maximal number of rows to return.
+ * \return  The indices of the nearest rows, the nearest one first.
+ * \throws  invalid_argument    In case the dimensions differ.
+ *
+ * This method searches the batch exhaustively for the rows of the smallest
+ * Euclidean distance to the given query.  The dimension is checked once for the
+ * whole batch.  Rows of the same distance are ordered by their indices.
+ */
+
+template <typename T>
+vector <dimension_t> Rnpp_batch <T> :: nearest (const row_t &      query,
+                                                const dimension_t  neighbours)
+    const
+{
+    this -> assert_same_dimension (query);
+
+    const dimension_t       k           = min (neighbours, this -> count);
+    const scalar_t *        q           = query.get_components ().data ();
+    const T *               row         = this -> components.data ();
+    svec_t                  distances   = svec_t (this -> count);
+    vector <dimension_t>    ret         = vector <dimension_t> (this -> count);
+
+    for (dimension_t i = 0x0; i < this -> count; i++, row += this -> dimension)
+    {
+        distances[i]    = kernel_distance_squared (row, q, this -> dimension);
+        ret[i]          = i;
+    };
+
+    partial_sort (ret.begin (), ret.begin () + k, ret.end (),
+                  [&] (const dimension_t a, const dimension_t b)
+                  {
+                      return distances[a] < distances[b]
+                          || (distances[a] == distances[b] && a < b);
+                  });
+
+    ret.resize (k);
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template vector <dimension_t> Rnbpp_batch :: nearest (const Rnfpp &,
+                                                      const dimension_t) const;
+template vector <dimension_t> Rndpp_batch :: nearest (const Rndpp &,
+                                                      const dimension_t) const;
+template vector <dimension_t> Rnfpp_batch :: nearest (const Rnfpp &,
+                                                      const dimension_t) const;
+template vector <dimension_t> Rnhpp_batch :: nearest (const Rnfpp &,
+                                                      const dimension_t) const;
+
+/******************************************************************************/
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_normalise.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Normalise all rows of this batch.
+ * \return  This batch.
+ * \throws  invalid_argument    In case a row is of norm zero.
+ *
+ * This method divides each row by its Euclidean norm like `Rnpp :: normalise`
+ * does.  All norms are determined and checked before the first row is changed
+ * such that the batch remains untouched in case of an error.
+ */
+
+template <typename T>
+Rnpp_batch <T> & Rnpp_batch <T> :: normalise_inplace (void)
+{
+    const T *   row     = this -> components.data ();
+    svec_t      norms   = svec_t (this -> count);
+
+    for (dimension_t i = 0x0; i < this -> count; i++, row += this -> dimension)
+    {
+        norms[i] = sqrt (kernel_inner (row, row, this -> dimension));
+
+        if (! abs (norms[i]))
+            RNPP_VIOLATION (invalid_argument,
+                            "A value unequal to zero is required!");
+    };
+
+    T * x = this -> components.data ();
+
+    for (dimension_t i = 0x0; i < this -> count; i++)
+        for (dimension_t j = 0x0; j < this -> dimension; j++, x++)
+            (* x) = T (scalar_t (* x) / norms[i]);
+
+    return (* this);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp_batch & Rnbpp_batch :: normalise_inplace (void);
+template Rndpp_batch & Rndpp_batch :: normalise_inplace (void);
+template Rnfpp_batch & Rnfpp_batch :: normalise_inplace (void);
+template Rnhpp_batch & Rnhpp_batch :: normalise_inplace (void);
+
+/******************************************************************************/
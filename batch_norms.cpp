@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_norms.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   The Euclidean norms of all rows.
+ * \return  The norm of each row, in order.
+ *
+ * The norms of a batch which is queried repeatedly can be computed once and
+ * passed to `cosine` for each query.  They become invalid as soon as the batch
+ * is modified.
+ */
+
+template <typename T>
+typename Rnpp_batch <T> :: svec_t Rnpp_batch <T> :: norms (void) const
+{
+    const T *   row = this -> components.data ();
+    svec_t      ret = svec_t (this -> count);
+
+    for (dimension_t i = 0x0; i < this -> count; i++, row += this -> dimension)
+        ret[i] = sqrt (kernel_inner (row, row, this -> dimension));
+
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template fvec_t Rnbpp_batch :: norms (void) const;
+template vector <double> Rndpp_batch :: norms (void) const;
+template fvec_t Rnfpp_batch :: norms (void) const;
+template fvec_t Rnhpp_batch :: norms (void) const;
+
+/******************************************************************************/
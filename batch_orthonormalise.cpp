@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_orthonormalise.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Orthonormalise the rows by the modified Gram-Schmidt process.
+ * \return  The number of linearly independent rows.
+ *
+ * This method replaces the rows of this batch in place by an orthonormal basis
+ * of their span such that the first `i` rows span the same space as before.
+ * Rows which depend linearly on the previous ones become zero.  The rows are
+ * processed in panels which are projected at once, without any temporary
+ * vector per row.  Components of a reduced precision are orthonormalised in
+ * `float`.
+ */
+
+template <typename T>
+dimension_t Rnpp_batch <T> :: orthonormalise (void)
+{
+    return kernel_orthonormalise (this -> components.data (), this -> count,
+                                  this -> dimension);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template dimension_t Rnbpp_batch :: orthonormalise (void);
+template dimension_t Rndpp_batch :: orthonormalise (void);
+template dimension_t Rnfpp_batch :: orthonormalise (void);
+template dimension_t Rnhpp_batch :: orthonormalise (void);
+
+/******************************************************************************/
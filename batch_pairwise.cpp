@@ -0,0 +1,329 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_pairwise.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Provide rows of a reduced precision as rows of the scalar type.
+ * \param   rows    The components to provide.
+ * \param   count   The number of components.
+ * \param   buffer  The buffer to convert the components into.
+ * \return  The converted components.
+ */
+
+template <typename T>
+static const float * pairwise_widen (const T *          rows,
+                                     const dimension_t  count,
+                                     fvec_t &           buffer)
+{
+    buffer.resize (count);
+    kernel_convert (rows, buffer.data (), count);
+    return buffer.data ();
+}
+
+
+
+/**
+ * \brief   Provide rows of the scalar type as they are.
+ * \param   rows    The components to provide.
+ * \return  The given components.
+ */
+
+static const double * pairwise_widen (const double *     rows,
+                                      const dimension_t,
+                                      vector <double> &)
+{
+    return rows;
+}
+
+static const float * pairwise_widen (const float *      rows,
+                                     const dimension_t,
+                                     fvec_t &)
+{
+    return rows;
+}
+
+
+
+/**
+ * \brief   Derive a metric from an inner product and the norms.
+ * \param   metric  The metric to derive.
+ * \param   product The inner product of two rows.
+ * \param   x       The norm of the first row.
+ * \param   y       The norm of the second row.
+ * \return  The metric of both rows.
+ *
+ * The squared distance is `x * x + y * y - 2 * product`; rounding may turn it
+ * slightly negative, so it is clamped to zero.  The cosine is divided by the
+ * product of the norms, which does not overflow or underflow unlike the product
+ * of the squared norms.
+ */
+
+template <typename S>
+static inline S pairwise_metric (const metric_t metric,
+                                 const S        product,
+                                 const S        x,
+                                 const S        y) noexcept
+{
+    const S squared = max (x * x + y * y - S (0x2) * product, S (0x0));
+
+    switch (metric)
+    {
+        case Rnpp_cosine:            return product / (x * y);
+        case Rnpp_euclidean:         return sqrt (squared);
+        case Rnpp_squared_euclidean: return squared;
+        default:                     return product;
+    };
+}
+
+
+
+/**
+ * \brief   The matrix of a metric between all rows of two batches.
+ * \param   other   The batch to compare the rows of this batch with.
+ * \param   metric  The metric to compute.
+ * \param   threads The maximal number of threads, zero for the hardware ones.
+ * \return  The metric of row `i` of this batch and row `j` of the other batch
+ *          at position `i * other.get_count () + j`.
+ * \throws  invalid_argument    In case the dimensions differ.
+ *
+ * This method computes the whole matrix at once.  See the overload below for
+ * the computation and for limiting the memory by computing it block by block.
+ */
+
+template <typename T>
+typename Rnpp_batch <T> :: svec_t
+Rnpp_batch <T> :: pairwise (const Rnpp_batch &  other,
+                            const metric_t      metric,
+                            const dimension_t   threads) const
+{
+    return this -> pairwise (other, metric, threads, 0x0, this -> count);
+}
+
+
+
+/**
+ * \brief   A block of rows of the matrix of a metric between two batches.
+ * \param   other   The batch to compare the rows of this batch with.
+ * \param   metric  The metric to compute.
+ * \param   threads The maximal number of threads, zero for the hardware ones.
+ * \param   first   The first row of this batch to compare.
+ * \param   rows    The number of rows of this batch to compare.
+ * \return  The metric of row `first + i` of this batch and row `j` of the other
+ *          batch at position `i * other.get_count () + j`.
+ * \throws  invalid_argument    In case the dimensions differ.
+ * \throws  out_of_range        In case the rows do not exist.
+ *
+ * This method computes the norms of the other batch on each call.  When the
+ * matrix is computed block by block, they should be computed once by `norms`
+ * and passed to the overload below.
+ */
+
+template <typename T>
+typename Rnpp_batch <T> :: svec_t
+Rnpp_batch <T> :: pairwise (const Rnpp_batch &  other,
+                            const metric_t      metric,
+                            const dimension_t   threads,
+                            const dimension_t   first,
+                            const dimension_t   rows) const
+{
+    return this -> pairwise (other, metric == Rnpp_inner_product
+                                    ? svec_t () : other.norms (),
+                             metric, threads, first, rows);
+}
+
+
+
+/**
+ * \brief   A block of rows of the matrix of a metric between two batches.
+ * \param   other   The batch to compare the rows of this batch with.
+ * \param   norms   The norms of the rows of the other batch, as computed by
+ *                  `norms`; ignored for inner products.
+ * \param   metric  The metric to compute.
+ * \param   threads The maximal number of threads, zero for the hardware ones.
+ * \param   first   The first row of this batch to compare.
+ * \param   rows    The number of rows of this batch to compare.
+ * \return  The metric of row `first + i` of this batch and row `j` of the other
+ *          batch at position `i * other.get_count () + j`.
+ * \throws  invalid_argument    In case the dimensions or the number of norms
+ *                              differ.
+ * \throws  out_of_range        In case the rows do not exist.
+ *
+ * All metrics are derived from the inner products of the rows, which are
+ * computed like a matrix product by the tiled matrix kernel, and from the
+ * norms.  The norms of the rows of this batch are computed once per row.  The
+ * rows of this batch are split into one contiguous range per thread and each
+ * range is processed in panels, such that the inner products of a panel are
+ * still cached when the metric is derived from them.  Components of a reduced
+ * precision are converted to `float` once per call, the whole other batch
+ * included; computing the matrix of such batches block by block therefore costs
+ * a conversion of the other batch and a buffer of its size for each block.
+ * Since the distances are derived from the norms, the distances of almost
+ * equal rows are less accurate than those computed by `distance`.  The cosine
+ * of a row of zero norm is NaN.
+ */
+
+template <typename T>
+typename Rnpp_batch <T> :: svec_t
+Rnpp_batch <T> :: pairwise (const Rnpp_batch &  other,
+                            const svec_t &      norms,
+                            const metric_t      metric,
+                            const dimension_t   threads,
+                            const dimension_t   first,
+                            const dimension_t   rows) const
+{
+    if (other.dimension != this -> dimension)
+        RNPP_VIOLATION (invalid_argument,
+                        "The given vectors have different dimensions!");
+
+    if (metric != Rnpp_inner_product && norms.size () != other.count)
+        RNPP_VIOLATION (invalid_argument,
+                        "The number of norms does not match the batch!");
+
+    if (first > this -> count || rows > this -> count - first)
+        RNPP_VIOLATION (out_of_range, "This row does not exist!");
+
+    const dimension_t   d       = this -> dimension;
+    const dimension_t   m       = other.count;
+    svec_t              buffer  = svec_t ();
+    svec_t              widened = svec_t ();
+    const scalar_t *    x       = pairwise_widen (this -> components.data ()
+                                                  + first * d, rows * d,
+                                                  buffer);
+    const scalar_t *    y       = pairwise_widen (other.components.data (),
+                                                  m * d, widened);
+    svec_t              ret     = svec_t (rows * m);
+
+    kernel_parallel_for (rows, kernel_workers (rows, threads),
+                         [&] (const dimension_t begin,
+                              const dimension_t end,
+                              const dimension_t)
+    {
+        for (dimension_t i = begin; i < end; i += kernel_panel)
+        {
+            const dimension_t   block   = min (end - i, kernel_panel);
+            scalar_t *          out     = ret.data () + i * m;
+
+            kernel_inner_matrix (x + i * d, block, y, m, d, out);
+
+            if (metric == Rnpp_inner_product)
+                continue;
+
+            for (dimension_t r = 0x0; r < block; r++, out += m)
+            {
+                const scalar_t * row    = x + (i + r) * d;
+                const scalar_t   norm   = sqrt (kernel_inner (row, row, d));
+
+                for (dimension_t j = 0x0; j < m; j++)
+                    out[j] = pairwise_metric (metric, out[j], norm, norms[j]);
+            };
+        };
+    });
+
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template fvec_t Rnbpp_batch :: pairwise (const Rnbpp_batch &,
+                                         const metric_t,
+                                         const dimension_t) const;
+template fvec_t Rnbpp_batch :: pairwise (const Rnbpp_batch &,
+                                         const metric_t,
+                                         const dimension_t,
+                                         const dimension_t,
+                                         const dimension_t) const;
+template fvec_t Rnbpp_batch :: pairwise (const Rnbpp_batch &,
+                                         const fvec_t &,
+                                         const metric_t,
+                                         const dimension_t,
+                                         const dimension_t,
+                                         const dimension_t) const;
+
+template vector <double> Rndpp_batch :: pairwise (const Rndpp_batch &,
+                                                  const metric_t,
+                                                  const dimension_t) const;
+template vector <double> Rndpp_batch :: pairwise (const Rndpp_batch &,
+                                                  const metric_t,
+                                                  const dimension_t,
+                                                  const dimension_t,
+                                                  const dimension_t) const;
+template vector <double> Rndpp_batch :: pairwise (const Rndpp_batch &,
+                                                  const vector <double> &,
+                                                  const metric_t,
+                                                  const dimension_t,
+                                                  const dimension_t,
+                                                  const dimension_t) const;
+
+template fvec_t Rnfpp_batch :: pairwise (const Rnfpp_batch &,
+                                         const metric_t,
+                                         const dimension_t) const;
+template fvec_t Rnfpp_batch :: pairwise (const Rnfpp_batch &,
+                                         const metric_t,
+                                         const dimension_t,
+                                         const dimension_t,
+                                         const dimension_t) const;
+template fvec_t Rnfpp_batch :: pairwise (const Rnfpp_batch &,
+                                         const fvec_t &,
+                                         const metric_t,
+                                         const dimension_t,
+                                         const dimension_t,
+                                         const dimension_t) const;
+
+template fvec_t Rnhpp_batch :: pairwise (const Rnhpp_batch &,
+                                         const metric_t,
+                                         const dimension_t) const;
+template fvec_t Rnhpp_batch :: pairwise (const Rnhpp_batch &,
+                                         const metric_t,
+                                         const dimension_t,
+                                         const dimension_t,
+                                         const dimension_t) const;
+template fvec_t Rnhpp_batch :: pairwise (const Rnhpp_batch &,
+                                         const fvec_t &,
+                                         const metric_t,
+                                         const dimension_t,
+                                         const dimension_t,
+                                         const dimension_t) const;
+
+/******************************************************************************/
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_place.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Place the rows of this batch on the NUMA nodes of their workers.
+ * \param   threads The number of threads to scan this batch with.
+ * \return  Whether all rows have been placed.
+ *
+ * This method partitions the rows like the scans with the given number of
+ * threads do and moves each range to the node its worker runs on.  Zero
+ * threads will select the number of hardware threads.  On machines with a
+ * single node, nothing is moved.  Pages which their node cannot take stay
+ * where they are.
+ *
+ * The placement is lost as soon as the batch grows beyond its capacity.  No
+ * memory policy is left behind, such that the heap memory which later reuses
+ * the released range, also that of other objects, is placed by first touch.
+ */
+
+template <typename T>
+bool Rnpp_batch <T> :: place (const dimension_t threads)
+{
+    const dimension_t   workers = kernel_workers (this -> count, threads);
+    const dimension_t   row     = this -> dimension * sizeof (T);
+    bool                ret     = true;
+
+    for (dimension_t w = 0x0; w < workers; w++)
+    {
+        const dimension_t begin = this -> count * w / workers;
+        const dimension_t end   = this -> count * (w + 0x1) / workers;
+
+        ret &= kernel_numa_bind (this -> components.data ()
+                                 + begin * this -> dimension,
+                                 (end - begin) * row,
+                                 kernel_numa_node (w, workers));
+    };
+
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template bool Rnbpp_batch :: place (const dimension_t);
+template bool Rndpp_batch :: place (const dimension_t);
+template bool Rnfpp_batch :: place (const dimension_t);
+template bool Rnhpp_batch :: place (const dimension_t);
+
+/******************************************************************************/
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_push_back.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Append a row to this batch.
+ * \param   row     The vector to append.
+ * \throws  invalid_argument    In case the row is of a different dimension.
+ *
+ * This method appends the given vector as the last row of this batch, rounding
+ * its components to the storage precision.  An empty batch adopts the
+ * dimension of the first row appended to it.
+ */
+
+template <typename T>
+void Rnpp_batch <T> :: push_back (const row_t & row)
+{
+    if (! this -> count)
+        this -> dimension = row.get_dimension ();
+
+    this -> assert_same_dimension (row);
+
+    const dimension_t offset = this -> count * this -> dimension;
+
+    this -> components.resize (offset + this -> dimension);
+    kernel_convert (row.get_components ().data (),
+                    this -> components.data () + offset, this -> dimension);
+
+    this -> count++;
+    return;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp_batch :: push_back (const Rnfpp &);
+template void Rndpp_batch :: push_back (const Rndpp &);
+template void Rnfpp_batch :: push_back (const Rnfpp &);
+template void Rnhpp_batch :: push_back (const Rnfpp &);
+
+/******************************************************************************/
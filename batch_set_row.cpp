@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        batch_set_row.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the vector batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Set a row of this batch.
+ * \param   index   The index of the row to overwrite.
+ * \param   row     The vector to store.
+ * \throws  invalid_argument    In case the row is of a different dimension.
+ * \throws  out_of_range        In case the given row does not exist.
+ *
+ * This method overwrites the requested row of this batch with the given
+ * vector, rounding its components to the storage precision.
+ */
+
+template <typename T>
+void Rnpp_batch <T> :: set_row (const dimension_t index, const row_t & row)
+{
+    this -> assert_range (index);
+    this -> assert_same_dimension (row);
+
+    kernel_convert (row.get_components ().data (),
+                    this -> components.data () + index * this -> dimension,
+                    this -> dimension);
+
+    return;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp_batch :: set_row (const dimension_t, const Rnfpp &);
+template void Rndpp_batch :: set_row (const dimension_t, const Rndpp &);
+template void Rnfpp_batch :: set_row (const dimension_t, const Rnfpp &);
+template void Rnhpp_batch :: set_row (const dimension_t, const Rnfpp &);
+
+/******************************************************************************/
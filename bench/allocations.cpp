@@ -0,0 +1,340 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The allocation check.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        allocations.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements a driver which checks that the operations documented to
+ * be free of allocations do not allocate.  It replaces the global allocation
+ * functions by counting ones and calls each operation for all component types.
+ * The driver is not part of the library; it is built against the static one
+ * from the main directory and run like this:
+ *
+ *     g++ -std=c++11 -pthread allocations.cpp ../libRnfpp.a -o allocations
+ *     ./allocations
+ *
+ * Any allocation is reported and fails the run with a non-zero exit code.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+// This project.
+#include "../Rnfpp.hpp"
+
+// Namespace settings.
+using std :: bad_alloc;
+using std :: fprintf;
+using std :: free;
+using std :: malloc;
+using std :: nothrow_t;
+using std :: size_t;
+
+
+
+/*
+ * Allocation counters.
+ */
+
+static atomic <uint64_t> allocations    (0x0);
+static atomic <uint64_t> deallocations  (0x0);
+
+
+
+/**
+ * \brief   Allocate memory and count the allocation.
+ * \param   size    The number of bytes to allocate.
+ * \return  The allocated memory.
+ * \throws  bad_alloc   In case no memory is available.
+ *
+ * This replacement of the global allocation function counts each call before
+ * it forwards the request to `malloc`.  All other allocation functions are
+ * redirected to this one or count likewise.
+ */
+
+void * operator new (size_t size)
+{
+    void * const ret = malloc (size ? size : 0x1);
+
+    allocations++;
+
+    if (! ret)
+        throw bad_alloc ();
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Allocate memory for an array and count the allocation.
+ * \param   size    The number of bytes to allocate.
+ * \return  The allocated memory.
+ * \throws  bad_alloc   In case no memory is available.
+ */
+
+void * operator new [] (size_t size)
+{
+    return operator new (size);
+}
+
+
+
+/**
+ * \brief   Allocate memory without throwing and count the allocation.
+ * \param   size    The number of bytes to allocate.
+ * \return  The allocated memory or `nullptr`.
+ */
+
+void * operator new (size_t size, const nothrow_t &) noexcept
+{
+    allocations++;
+    return malloc (size ? size : 0x1);
+}
+
+
+
+/**
+ * \brief   Allocate memory for an array without throwing and count the
+ *          allocation.
+ * \param   size    The number of bytes to allocate.
+ * \return  The allocated memory or `nullptr`.
+ */
+
+void * operator new [] (size_t size, const nothrow_t &) noexcept
+{
+    allocations++;
+    return malloc (size ? size : 0x1);
+}
+
+
+
+/**
+ * \brief   Release memory and count the deallocation.
+ * \param   data    The memory to release.
+ */
+
+void operator delete (void * data) noexcept
+{
+    deallocations += data != nullptr;
+    free (data);
+    return;
+}
+
+
+
+/**
+ * \brief   Release the memory of an array and count the deallocation.
+ * \param   data    The memory to release.
+ */
+
+void operator delete [] (void * data) noexcept
+{
+    operator delete (data);
+    return;
+}
+
+
+
+/**
+ * \brief   Release memory allocated without throwing.
+ * \param   data    The memory to release.
+ */
+
+void operator delete (void * data, const nothrow_t &) noexcept
+{
+    operator delete (data);
+    return;
+}
+
+
+
+/**
+ * \brief   Release the memory of an array allocated without throwing.
+ * \param   data    The memory to release.
+ */
+
+void operator delete [] (void * data, const nothrow_t &) noexcept
+{
+    operator delete (data);
+    return;
+}
+
+
+
+/*
+ * Checks.
+ */
+
+/**
+ * \brief   Check the operations of a vector type documented to be free of
+ *          allocations.
+ * \param   name    The name of the vector type.
+ * \return  The number of operations which allocated or released memory.
+ *
+ * Each operation runs once in order to initialise any lazy state of the
+ * library, such as the profiles of instrumented builds.  Then, it runs several
+ * times between two readings of the counters, which must not change.  The
+ * operand is reset before each call outside of the measured range.  Every
+ * offending operation is reported on `stderr`.
+ */
+
+template <typename T>
+static dimension_t check (const char * name)
+{
+    typedef typename Rnpp <T> :: scalar_t   scalar_t;
+    typedef typename Rnpp <T> :: vec_t      vec_t;
+
+    const dimension_t   count   = 0x41;
+    const dimension_t   calls   = 0x10;
+    fvec_t              x       = fvec_t (count);
+    fvec_t              y       = fvec_t (count);
+    dimension_t         ret     = 0x0;
+    volatile scalar_t   sink    = scalar_t (0x0);
+    volatile bool       equal   = false;
+
+    for (dimension_t i = 0x0; i < count; i++)
+    {
+        x[i] = float (i % 0x7) - 3.0f;
+        y[i] = float (i % 0x5) + 0.5f;
+    };
+
+    x[count - 0x1] = 1.0f;
+
+    const Rnpp <T>  initial = Rnpp <T> (Rnfpp (x));
+    const Rnpp <T>  b       = Rnpp <T> (Rnfpp (y));
+    const vec_t     v       = b.get_components ();
+    const scalar_t  s       = scalar_t (0x2);
+    Rnpp <T>        a       = initial;
+
+    const struct
+    {
+        const char *            name;
+        function <void (void)>  operation;
+    } operations [] =
+    {
+        {"operator += (scalar_t)",  [&] (void) { a += s; }},
+        {"operator += (vec_t)",     [&] (void) { a += v; }},
+        {"operator += (Rnpp)",      [&] (void) { a += b; }},
+        {"operator -= (scalar_t)",  [&] (void) { a -= s; }},
+        {"operator -= (vec_t)",     [&] (void) { a -= v; }},
+        {"operator -= (Rnpp)",      [&] (void) { a -= b; }},
+        {"operator *= (scalar_t)",  [&] (void) { a *= s; }},
+        {"operator /= (scalar_t)",  [&] (void) { a /= s; }},
+        {"operator == (vec_t)",     [&] (void) { equal = a == v; }},
+        {"operator == (Rnpp)",      [&] (void) { equal = a == b; }},
+        {"affinise",                [&] (void) { a.affinise (); }},
+        {"cosine",                  [&] (void) { sink = a.cosine (b); }},
+        {"distance (vec_t)",        [&] (void) { sink = a.distance (v); }},
+        {"distance (Rnpp)",         [&] (void) { sink = a.distance (b); }},
+        {"inner (vec_t)",           [&] (void) { sink = a.inner (v); }},
+        {"inner (Rnpp)",            [&] (void) { sink = a.inner (b); }},
+        {"norm",                    [&] (void) { sink = a.norm (); }},
+        {"normalise",               [&] (void) { a.normalise (); }}
+    };
+
+    for (const auto & operation : operations)
+    {
+        a = initial;
+        operation.operation ();
+
+        uint64_t            allocated   = 0x0;
+        uint64_t            released    = 0x0;
+
+        for (dimension_t i = 0x0; i < calls; i++)
+        {
+            a = initial;
+
+            const uint64_t  before_new      = allocations;
+            const uint64_t  before_delete   = deallocations;
+
+            operation.operation ();
+
+            allocated   += allocations - before_new;
+            released    += deallocations - before_delete;
+        };
+
+        if (allocated || released)
+        {
+            fprintf (stderr, "FAILED:  %s :: %s allocated %llu and released "
+                             "%llu times in %u calls.\n",
+                     name, operation.name, (unsigned long long) allocated,
+                     (unsigned long long) released, unsigned (calls));
+            ret++;
+        };
+    };
+
+    static_cast <void> (sink);
+    static_cast <void> (equal);
+    return ret;
+}
+
+
+
+/*
+ * Driver.
+ */
+
+/**
+ * \brief   Run the allocation checks for all vector types.
+ * \return  `EXIT_SUCCESS` if no checked operation allocated, `EXIT_FAILURE`
+ *          otherwise.
+ *
+ * The driver is linked against the library, such that the replaced allocation
+ * functions also serve the allocations within the library.  Its exit code is
+ * meant to fail builds.
+ */
+
+int main (void)
+{
+    dimension_t failures = 0x0;
+
+    failures += check <bfloat16_t>  ("Rnbpp");
+    failures += check <double>      ("Rndpp");
+    failures += check <float>       ("Rnfpp");
+    failures += check <half_t>      ("Rnhpp");
+
+    if (failures)
+    {
+        fprintf (stderr, "FAILED:  %u operations allocated memory.\n",
+                 unsigned (failures));
+        return EXIT_FAILURE;
+    };
+
+    fputs ("All checked operations are free of allocations.\n", stdout);
+    return EXIT_SUCCESS;
+}
+
+/******************************************************************************/
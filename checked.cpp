@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The checked vector handle.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        checked.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the checked vector handle.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Construct a new Rnpp_checked object from a vector.
+ * \param   rnpp        The vector to refer to.
+ * \param   dimension   The expected dimension.
+ * \throws  invalid_argument    In case the vector is of a different dimension.
+ *
+ * This constructor checks the dimension of the given vector once.  The handle
+ * refers to the components of the vector without copying them.
+ */
+
+template <typename T>
+Rnpp_checked <T> :: Rnpp_checked (const Rnpp <T> &     rnpp,
+                                  const dimension_t    dimension)
+    : components (rnpp.get_components ().data ()), dimension (dimension)
+{
+    if (rnpp.get_dimension () != dimension)
+        RNPP_VIOLATION (invalid_argument,
+                        "The given vectors have different dimensions!");
+
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp_checked object from a row of a batch.
+ * \param   batch   The batch to refer to.
+ * \param   index   The row to refer to.
+ * \throws  out_of_range    In case the given row does not exist.
+ *
+ * This constructor checks the given row once.  The handle refers to the
+ * components of the row in place and adopts the dimension of the batch.
+ */
+
+template <typename T>
+Rnpp_checked <T> :: Rnpp_checked (const Rnpp_batch <T> &   batch,
+                                  const dimension_t        index)
+    : components (batch.get_components ().data ()),
+      dimension (batch.get_dimension ())
+{
+    batch.assert_range (index);
+    this -> components += index * this -> dimension;
+    return;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp_checked :: Rnpp_checked (const Rnbpp &, const dimension_t);
+template Rnbpp_checked :: Rnpp_checked (const Rnbpp_batch &,
+                                        const dimension_t);
+
+template Rndpp_checked :: Rnpp_checked (const Rndpp &, const dimension_t);
+template Rndpp_checked :: Rnpp_checked (const Rndpp_batch &,
+                                        const dimension_t);
+
+template Rnfpp_checked :: Rnpp_checked (const Rnfpp &, const dimension_t);
+template Rnfpp_checked :: Rnpp_checked (const Rnfpp_batch &,
+                                        const dimension_t);
+
+template Rnhpp_checked :: Rnpp_checked (const Rnhpp &, const dimension_t);
+template Rnhpp_checked :: Rnpp_checked (const Rnhpp_batch &,
+                                        const dimension_t);
+
+/******************************************************************************/
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The checked vector handle.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        checked_distance.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the checked vector handle.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   The distance to another handle.
+ * \param   other   The handle to calculate the distance to.
+ * \return  The Euclidean distance.
+ * \throws  invalid_argument    In case the handles are of different
+ *                              dimensions.
+ *
+ * This method compares the validated dimensions of both handles, a single
+ * integer comparison, instead of the lengths of the referred vectors.  The
+ * comparison is compiled away with `__RNFPP_UNCHECKED__`.
+ */
+
+template <typename T>
+typename Rnpp_checked <T> :: scalar_t
+Rnpp_checked <T> :: distance (const Rnpp_checked & other) const
+{
+    if (other.dimension != this -> dimension)
+        RNPP_VIOLATION (invalid_argument,
+                        "The given vectors have different dimensions!");
+
+    KERNEL_PROFILE (Rnpp_distance, this -> dimension, 0x0);
+    return sqrt (kernel_distance_squared (this -> components, other.components,
+                                          this -> dimension));
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template float Rnbpp_checked :: distance (const Rnbpp_checked &) const;
+template double Rndpp_checked :: distance (const Rndpp_checked &) const;
+template float Rnfpp_checked :: distance (const Rnfpp_checked &) const;
+template float Rnhpp_checked :: distance (const Rnhpp_checked &) const;
+
+/******************************************************************************/
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The checked vector handle.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        checked_get_components.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the checked vector handle.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Query the components this handle refers to.
+ * \return  The first component.
+ *
+ * This method queries the components of the vector or the row this handle has
+ * been validated for.
+ */
+
+template <typename T>
+const T * Rnpp_checked <T> :: get_components (void) const noexcept
+{
+    return this -> components;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template const bfloat16_t * Rnbpp_checked :: get_components (void)
+    const noexcept;
+template const double * Rndpp_checked :: get_components (void) const noexcept;
+template const float * Rnfpp_checked :: get_components (void) const noexcept;
+template const half_t * Rnhpp_checked :: get_components (void) const noexcept;
+
+/******************************************************************************/
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnfpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        clamp.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnfpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Limit the components of this vector to an interval.
+ * \param   lower   The lower bound.
+ * \param   upper   The upper bound.
+ * \return  The vector of the limited components.
+ * \throws  invalid_argument    In case the lower bound exceeds the upper one.
+ *
+ * This method returns a new vector of the components of this vector limited
+ * to the interval between both bounds, following `std :: clamp`.
+ */
+
+template <typename T>
+Rnpp <T> Rnpp <T> :: clamp (const scalar_t lower, const scalar_t upper) const
+{
+    if (upper < lower)
+        RNPP_VIOLATION (invalid_argument,
+                        "The lower bound exceeds the upper one!");
+
+    Rnpp <T> ret = Rnpp <T> (this -> get_dimension ());
+
+    kernel_clamp (lower, upper, this -> components.data (),
+                  ret.components.data (), this -> get_dimension ());
+    return ret;
+}
+
+
+
+/**
+ * \brief   Limit the components of this vector to an interval.
+ * \param   lower   The lower bound.
+ * \param   upper   The upper bound.
+ * \return  This vector.
+ * \throws  invalid_argument    In case the lower bound exceeds the upper one.
+ *
+ * This method limits the components of this vector to the interval between
+ * both bounds in a single pass.
+ */
+
+template <typename T>
+Rnpp <T> & Rnpp <T> :: clamp_inplace (const scalar_t lower,
+                                      const scalar_t upper)
+{
+    if (upper < lower)
+        RNPP_VIOLATION (invalid_argument,
+                        "The lower bound exceeds the upper one!");
+
+    kernel_clamp (lower, upper, this -> components.data (),
+                  this -> components.data (), this -> get_dimension ());
+    return (* this);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp Rnbpp :: clamp (const float, const float) const;
+template Rnbpp & Rnbpp :: clamp_inplace (const float, const float);
+
+template Rndpp Rndpp :: clamp (const double, const double) const;
+template Rndpp & Rndpp :: clamp_inplace (const double, const double);
+
+template Rnfpp Rnfpp :: clamp (const float, const float) const;
+template Rnfpp & Rnfpp :: clamp_inplace (const float, const float);
+
+template Rnhpp Rnhpp :: clamp (const float, const float) const;
+template Rnhpp & Rnhpp :: clamp_inplace (const float, const float);
+
+/******************************************************************************/
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        cosine.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   The cosine of the angle between two vectors.
+ * \param   other   The vector to compare with.
+ * \return  The cosine similarity.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method determines the inner product and both squared norms by the
+ * kernels.  The square roots are taken separately since the product of the
+ * squared norms overflows or underflows already for moderate magnitudes.  The
+ * cosine of a zero vector is NaN.
+ * In order to compare many vectors with the same ones, the norms can be cached
+ * by `Rnpp_shared` or by the overload of `Rnpp_batch :: cosine` taking the
+ * norms of the rows.
+ */
+
+template <typename T>
+typename Rnpp <T> :: scalar_t Rnpp <T> :: cosine (const Rnpp & other) const
+{
+    this -> assert_same_dimension (other);
+
+    const T *           x   = this -> components.data ();
+    const T *           y   = other.components.data ();
+    const dimension_t   d   = this -> get_dimension ();
+
+    return kernel_inner (x, y, d) / (sqrt (kernel_inner (x, x, d))
+                                     * sqrt (kernel_inner (y, y, d)));
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template float Rnbpp :: cosine (const Rnbpp &) const;
+template double Rndpp :: cosine (const Rndpp &) const;
+template float Rnfpp :: cosine (const Rnfpp &) const;
+template float Rnhpp :: cosine (const Rnhpp &) const;
+
+/******************************************************************************/
@@ -41,14 +41,26 @@
 
 
 /**
- * \brief   Destruct an Rnfpp object.
+ * \brief   Destruct an Rnpp object.
  *
  * This is the default destructor.
  */
 
-Rnfpp :: ~Rnfpp (void)
+template <typename T>
+Rnpp <T> :: ~Rnpp (void)
 {
     return;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp :: ~Rnpp (void);
+template Rndpp :: ~Rnpp (void);
+template Rnfpp :: ~Rnpp (void);
+template Rnhpp :: ~Rnpp (void);
+
 /******************************************************************************/
@@ -36,6 +36,7 @@
  */
 
 // This project.
+#include "kernels.hpp"
 #include "Rnfpp.hpp"
 
 
@@ -46,13 +47,18 @@
  * \return  The distance.
  * \throws  invalid_argument    In case the vectors are of different dimensions.
  *
- * This method determines the distance between this vector and the other one.
+ * This method determines the distance between this vector and the other one
+ * without copying it.
  */
 
-float Rnfpp :: distance (const fvec_t & other) const
+template <typename T>
+typename Rnpp <T> :: scalar_t Rnpp <T> :: distance (const vec_t & other) const
 {
+    KERNEL_PROFILE (Rnpp_distance, this -> get_dimension (), 0x0);
     this -> assert_same_dimension (other);
-    return ((* this) - Rnfpp (other)).norm ();
+    return sqrt (kernel_distance_squared (this -> components.data (),
+                                          other.data (),
+                                          this -> get_dimension ()));
 }
 
 
@@ -64,12 +70,44 @@ float Rnfpp :: distance (const fvec_t & other) const
  * \throws  invalid_argument    In case the vectors are of different dimensions.
  *
  * This method determines the distance between this vector and the other one.
+ * Components of a reduced precision are converted on the fly and accumulated in
+ * `float`.
  */
 
-float Rnfpp :: distance (const Rnfpp & other) const
+template <typename T>
+template <typename U, typename>
+typename Rnpp <T> :: scalar_t Rnpp <T> :: distance (const Rnpp <U> & other)
+    const
 {
+    KERNEL_PROFILE (Rnpp_distance, this -> get_dimension (), 0x0);
     this -> assert_same_dimension (other);
-    return ((* this) - other).norm ();
+    return sqrt (kernel_distance_squared (this -> components.data (),
+                                          other.get_components ().data (),
+                                          this -> get_dimension ()));
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template float Rnbpp :: distance (const Rnbpp :: vec_t &) const;
+template float Rnbpp :: distance (const Rnbpp &) const;
+template float Rnbpp :: distance (const Rnfpp &) const;
+template float Rnbpp :: distance (const Rnhpp &) const;
+
+template double Rndpp :: distance (const Rndpp :: vec_t &) const;
+template double Rndpp :: distance (const Rndpp &) const;
+
+template float Rnfpp :: distance (const Rnfpp :: vec_t &) const;
+template float Rnfpp :: distance (const Rnbpp &) const;
+template float Rnfpp :: distance (const Rnfpp &) const;
+template float Rnfpp :: distance (const Rnhpp &) const;
+
+template float Rnhpp :: distance (const Rnhpp :: vec_t &) const;
+template float Rnhpp :: distance (const Rnbpp &) const;
+template float Rnhpp :: distance (const Rnfpp &) const;
+template float Rnhpp :: distance (const Rnhpp &) const;
+
 /******************************************************************************/
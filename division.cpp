@@ -49,16 +49,29 @@
  * This method will scale this vector by the given scalar by division.
  */
 
-Rnfpp Rnfpp :: operator / (const float other) const
+template <typename T>
+Rnpp <T> Rnpp <T> :: operator / (const scalar_t other) const
 {
     this -> assert_non_zero (other);
 
-    Rnfpp ret = Rnfpp (this -> get_dimension ());
-
-    for (dimension_t i = 0x0; i < this -> get_dimension (); i++)
-        ret[i] = (* this)[i] / other;
+    Rnpp <T> ret = (* this);
 
+    ret /= other;
     return ret;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp Rnbpp :: operator / (const float) const;
+
+template Rndpp Rndpp :: operator / (const double) const;
+
+template Rnfpp Rnfpp :: operator / (const float) const;
+
+template Rnhpp Rnhpp :: operator / (const float) const;
+
 /******************************************************************************/
@@ -36,24 +36,47 @@
  */
 
 // This project.
-#include "Rnfpp.hpp"
+#include "kernels.hpp"
 
 
 
 /**
- * \brief   The division operator.
+ * \brief   The division assignment operator.
  * \param   other   The scalar to divide this vector by.
- * \return  The scaled vector.
+ * \return  This vector.
  * \throws  invalid_argument    In case the scalar should be zero.
  *
- * This method will scale this vector by the given scalar by division.
+ * This method will scale this vector by the given scalar by division.  The
+ * components are updated in place without allocating memory.
  */
 
-Rnfpp & Rnfpp :: operator /= (const float other)
+template <typename T>
+Rnpp <T> & Rnpp <T> :: operator /= (const scalar_t other)
 {
+    KERNEL_PROFILE (Rnpp_division, this -> get_dimension (), 0x0);
     this -> assert_non_zero (other);
-    this -> set_components ((* this) / other);
+
+    const dimension_t   dimension   = this -> get_dimension ();
+    T *                 x           = this -> components.data ();
+
+    for (dimension_t i = 0x0; i < dimension; i++)
+        x[i] = T (scalar_t (x[i]) / other);
+
     return (* this);
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp & Rnbpp :: operator /= (const float);
+
+template Rndpp & Rndpp :: operator /= (const double);
+
+template Rnfpp & Rnfpp :: operator /= (const float);
+
+template Rnhpp & Rnhpp :: operator /= (const float);
+
 /******************************************************************************/
@@ -57,6 +57,7 @@ archiver.call   = [ archiver.self ' ' archiver.args ' ' archiver.out ' '     ...
 
 compiler.args   = [ ' -std=c++11 -Wall -Werror -Wextra -Wpedantic -c '       ...
                     ' -D__RNFPP_INTERNAL__ '                                 ...
+                    ' -pthread '                                             ...
                     ' -D__WINDOWS__ -D__MAKE_DLL__ '                         ...
                   ];
 compiler.in     = glob ('*.cpp');
@@ -65,6 +66,7 @@ compiler.self   = 'g++';
 compiler.call   = [compiler.self ' ' compiler.args ' '];
 
 linker.args = [ ' -shared -Wl,--out-implib,' archiver.out                    ...
+                ' -pthread '                                                 ...
                 ' -Wl,--enable-auto-image-base '                             ...
                 % ' -Wl,--export-all-symbols '                                 ...
               ];
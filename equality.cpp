@@ -36,6 +36,7 @@
  */
 
 // This project.
+#include "kernels.hpp"
 #include "Rnfpp.hpp"
 
 
@@ -46,12 +47,16 @@
  * \return  Whether both vectors contain the same components.
  *
  * This method checks whether both vectors, this and the other one, share both
- * the same dimension *and* the same components.
+ * the same dimension *and* the same components.  The components are compared
+ * in place by a vectorised kernel which stops at the first difference.
  */
 
-bool Rnfpp :: operator == (const fvec_t & other) const noexcept
+template <typename T>
+bool Rnpp <T> :: operator == (const vec_t & other) const noexcept
 {
-    return this -> same_dimension (other) ? (* this) == Rnfpp (other) : false;
+    return this -> same_dimension (other)
+        && kernel_equal (this -> components.data (), other.data (),
+                         this -> get_dimension ());
 }
 
 
@@ -65,20 +70,28 @@ bool Rnfpp :: operator == (const fvec_t & other) const noexcept
  * the same dimension *and* the same components.
  */
 
-bool Rnfpp :: operator == (const Rnfpp & other) const noexcept
+template <typename T>
+bool Rnpp <T> :: operator == (const Rnpp <T> & other) const noexcept
 {
-    bool ret = this -> same_dimension (other);
+    return (* this) == other.components;
+}
 
-    for (dimension_t i = 0x0; ret && i < this -> get_dimension (); i++)
-    {
-        const float otr = other[i];
-        const float ths = (* this)[i];
 
-        if (otr < ths || otr > ths)
-            ret = false;
-    };
 
-    return ret;
-}
+/*
+ * Explicit instantiations.
+ */
+
+template bool Rnbpp :: operator == (const Rnbpp :: vec_t &) const noexcept;
+template bool Rnbpp :: operator == (const Rnbpp &) const noexcept;
+
+template bool Rndpp :: operator == (const Rndpp :: vec_t &) const noexcept;
+template bool Rndpp :: operator == (const Rndpp &) const noexcept;
+
+template bool Rnfpp :: operator == (const Rnfpp :: vec_t &) const noexcept;
+template bool Rnfpp :: operator == (const Rnfpp &) const noexcept;
+
+template bool Rnhpp :: operator == (const Rnhpp :: vec_t &) const noexcept;
+template bool Rnhpp :: operator == (const Rnhpp &) const noexcept;
 
 /******************************************************************************/
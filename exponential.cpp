@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnfpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        exponential.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnfpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Apply the exponential function to this vector.
+ * \return  The vector of the powers of Euler's number.
+ *
+ * This method returns a new vector of the powers of Euler's number of the
+ * components of this vector.
+ * In `float`, the function is approximated in the vector registers with a
+ * relative error of about two units in the last place; results beyond the
+ * range of normal numbers are flushed to zero or infinity.
+ */
+
+template <typename T>
+Rnpp <T> Rnpp <T> :: exponential (void) const
+{
+    Rnpp <T> ret = Rnpp <T> (this -> get_dimension ());
+
+    kernel_unary (kernel_exponential, this -> components.data (),
+                  ret.components.data (), this -> get_dimension ());
+    return ret;
+}
+
+
+
+/**
+ * \brief   Apply the exponential function to this vector.
+ * \return  This vector.
+ *
+ * This method replaces the components of this vector by their powers of Euler's
+ * number in a single pass.
+ */
+
+template <typename T>
+Rnpp <T> & Rnpp <T> :: exponential_inplace (void)
+{
+    kernel_unary (kernel_exponential, this -> components.data (),
+                  this -> components.data (), this -> get_dimension ());
+    return (* this);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp Rnbpp :: exponential (void) const;
+template Rnbpp & Rnbpp :: exponential_inplace (void);
+
+template Rndpp Rndpp :: exponential (void) const;
+template Rndpp & Rndpp :: exponential_inplace (void);
+
+template Rnfpp Rnfpp :: exponential (void) const;
+template Rnfpp & Rnfpp :: exponential_inplace (void);
+
+template Rnhpp Rnhpp :: exponential (void) const;
+template Rnhpp & Rnhpp :: exponential_inplace (void);
+
+/******************************************************************************/
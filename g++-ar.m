@@ -57,6 +57,7 @@ archiver.call   = [ archiver.self ' ' archiver.args ' ' archiver.out ' '     ...
 
 compiler.args   = [ ' -std=c++11 -Wall -Werror -Wextra -Wpedantic -c '       ...
                     ' -D__RNFPP_INTERNAL__ '                                 ...
+                    ' -pthread '                                             ...
                   ];
 compiler.in     = '*.cpp';
 compiler.out    = '*.o';
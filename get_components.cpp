@@ -47,9 +47,24 @@
  * The getter method for the components held by this vector.
  */
 
-fvec_t & Rnfpp :: get_components (void) const noexcept
+template <typename T>
+typename Rnpp <T> :: vec_t & Rnpp <T> :: get_components (void) const noexcept
 {
-    return (fvec_t &) this -> components;
+    return (vec_t &) this -> components;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp :: vec_t & Rnbpp :: get_components (void) const noexcept;
+
+template Rndpp :: vec_t & Rndpp :: get_components (void) const noexcept;
+
+template Rnfpp :: vec_t & Rnfpp :: get_components (void) const noexcept;
+
+template Rnhpp :: vec_t & Rnhpp :: get_components (void) const noexcept;
+
 /******************************************************************************/
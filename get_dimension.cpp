@@ -47,9 +47,24 @@
  * This method queries the dimension of this vector.
  */
 
-dimension_t Rnfpp :: get_dimension (void) const noexcept
+template <typename T>
+dimension_t Rnpp <T> :: get_dimension (void) const noexcept
 {
     return this -> components.size ();
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template dimension_t Rnbpp :: get_dimension (void) const noexcept;
+
+template dimension_t Rndpp :: get_dimension (void) const noexcept;
+
+template dimension_t Rnfpp :: get_dimension (void) const noexcept;
+
+template dimension_t Rnhpp :: get_dimension (void) const noexcept;
+
 /******************************************************************************/
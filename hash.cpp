@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnfpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        hash.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnfpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   The content hash of this vector.
+ * \param   canonical   Whether to canonicalise the components beforehand.
+ * \return  The hash.
+ *
+ * This method hashes the components of this vector with a vectorised kernel.
+ * Canonical hashes replace negative zero by positive zero and each NaN by the
+ * same quiet NaN and convert reduced precisions to `float` beforehand; hence,
+ * vectors of the same scalar type which compare equal share their canonical
+ * hash unless they contain NaN, even if one of them is stored in a reduced
+ * precision.  Vectors of `double` components are hashed as `double` and do not
+ * share their hashes with `float` vectors.  Otherwise, the stored bits are
+ * hashed as they are.
+ */
+
+template <typename T>
+uint64_t Rnpp <T> :: hash (const bool canonical) const noexcept
+{
+    const dimension_t dimension = this -> get_dimension ();
+
+    return canonical
+         ? kernel_hash_canonical (this -> components.data (), dimension, 0x0)
+         : kernel_hash (this -> components.data (), dimension * sizeof (T),
+                        0x0);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template uint64_t Rnbpp :: hash (const bool) const noexcept;
+template uint64_t Rndpp :: hash (const bool) const noexcept;
+template uint64_t Rnfpp :: hash (const bool) const noexcept;
+template uint64_t Rnhpp :: hash (const bool) const noexcept;
+
+/******************************************************************************/
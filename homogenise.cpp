@@ -46,10 +46,25 @@
  * This method homogenises this vector.
  */
 
-void Rnfpp :: homogenise (void)
+template <typename T>
+void Rnpp <T> :: homogenise (void)
 {
     this -> components.push_back (0x1);
     return;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp :: homogenise (void);
+
+template void Rndpp :: homogenise (void);
+
+template void Rnfpp :: homogenise (void);
+
+template void Rnhpp :: homogenise (void);
+
 /******************************************************************************/
@@ -51,10 +51,25 @@
  * thrown.
  */
 
-float & Rnfpp :: operator [] (const dimension_t index) const
+template <typename T>
+T & Rnpp <T> :: operator [] (const dimension_t index) const
 {
     this -> assert_range (index);
-    return (float &) this -> components.at (index);
+    return (T &) this -> components[index];
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template bfloat16_t & Rnbpp :: operator [] (const dimension_t) const;
+
+template double & Rndpp :: operator [] (const dimension_t) const;
+
+template float & Rnfpp :: operator [] (const dimension_t) const;
+
+template half_t & Rnhpp :: operator [] (const dimension_t) const;
+
 /******************************************************************************/
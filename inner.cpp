@@ -36,6 +36,7 @@
  */
 
 // This project.
+#include "kernels.hpp"
 #include "Rnfpp.hpp"
 
 
@@ -46,13 +47,17 @@
  * \return  The inner product.
  * \throws  invalid_argument    In case the vectors are of different dimensions.
  *
- * This method determines the inner product of this vector with the other one.
+ * This method determines the inner product of this vector with the other one
+ * without copying it.
  */
 
-float Rnfpp :: inner (const fvec_t & other) const
+template <typename T>
+typename Rnpp <T> :: scalar_t Rnpp <T> :: inner (const vec_t & other) const
 {
+    KERNEL_PROFILE (Rnpp_inner, this -> get_dimension (), 0x0);
     this -> assert_same_dimension (other);
-    return this -> inner (Rnfpp (other));
+    return kernel_inner (this -> components.data (), other.data (),
+                         this -> get_dimension ());
 }
 
 
@@ -64,18 +69,43 @@ float Rnfpp :: inner (const fvec_t & other) const
  * \throws  invalid_argument    In case the vectors are of different dimensions.
  *
  * This method determines the inner product of this vector with the other one.
+ * Components of a reduced precision are converted on the fly and accumulated in
+ * `float`.
  */
 
-float Rnfpp :: inner (const Rnfpp & other) const
+template <typename T>
+template <typename U, typename>
+typename Rnpp <T> :: scalar_t Rnpp <T> :: inner (const Rnpp <U> & other) const
 {
+    KERNEL_PROFILE (Rnpp_inner, this -> get_dimension (), 0x0);
     this -> assert_same_dimension (other);
+    return kernel_inner (this -> components.data (),
+                         other.get_components ().data (),
+                         this -> get_dimension ());
+}
 
-    float ret = 0x0;
 
-    for (dimension_t i = 0x0; i < this -> get_dimension (); i++)
-        ret += (* this)[i] + other[i];
 
-    return ret;
-}
+/*
+ * Explicit instantiations.
+ */
+
+template float Rnbpp :: inner (const Rnbpp :: vec_t &) const;
+template float Rnbpp :: inner (const Rnbpp &) const;
+template float Rnbpp :: inner (const Rnfpp &) const;
+template float Rnbpp :: inner (const Rnhpp &) const;
+
+template double Rndpp :: inner (const Rndpp :: vec_t &) const;
+template double Rndpp :: inner (const Rndpp &) const;
+
+template float Rnfpp :: inner (const Rnfpp :: vec_t &) const;
+template float Rnfpp :: inner (const Rnbpp &) const;
+template float Rnfpp :: inner (const Rnfpp &) const;
+template float Rnfpp :: inner (const Rnhpp &) const;
+
+template float Rnhpp :: inner (const Rnhpp :: vec_t &) const;
+template float Rnhpp :: inner (const Rnbpp &) const;
+template float Rnhpp :: inner (const Rnfpp &) const;
+template float Rnhpp :: inner (const Rnhpp &) const;
 
 /******************************************************************************/
@@ -0,0 +1,338 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The vector update kernels.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernel_axpy.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the kernels which update vectors in place.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <cmath>
+
+// Intel intrinsics.
+#if defined (__AVX__) || defined (__SSE2__)
+#include <immintrin.h>
+#endif  // ! __AVX__ || __SSE2__
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: fma;
+
+
+
+/**
+ * \brief   Combine two vectors linearly in place.
+ * \param   alpha   The factor of `x`.
+ * \param   x       The vector to scale.
+ * \param   beta    The factor of `y`.
+ * \param   y       The vector to update.
+ * \param   count   The number of components.
+ *
+ * This is the double precision version of the kernel below.
+ */
+
+void kernel_axpby (const double         alpha,
+                   const double *       x,
+                   const double         beta,
+                   double *             y,
+                   const dimension_t    count) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    const __m256d a = _mm256_set1_pd (alpha);
+    const __m256d b = _mm256_set1_pd (beta);
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const __m256d p = _mm256_mul_pd (b, _mm256_loadu_pd (y + i));
+
+#if defined (__FMA__)
+        _mm256_storeu_pd (y + i, _mm256_fmadd_pd (a, _mm256_loadu_pd (x + i),
+                                                  p));
+#else
+        _mm256_storeu_pd (y + i, _mm256_add_pd (_mm256_mul_pd
+                                                (a, _mm256_loadu_pd (x + i)),
+                                                p));
+#endif  // ! __FMA__
+    };
+#elif defined (__SSE2__)
+    const __m128d a = _mm_set1_pd (alpha);
+    const __m128d b = _mm_set1_pd (beta);
+
+    for (; i + 0x2 <= count; i += 0x2)
+    {
+        const __m128d p = _mm_mul_pd (b, _mm_loadu_pd (y + i));
+
+        _mm_storeu_pd (y + i, _mm_add_pd (_mm_mul_pd (a, _mm_loadu_pd (x + i)),
+                                          p));
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+#if defined (__FMA__)
+        y[i] = fma (alpha, x[i], beta * y[i]);
+#else
+        y[i] = alpha * x[i] + beta * y[i];
+#endif  // ! __FMA__
+
+    return;
+}
+
+
+
+/**
+ * \brief   Combine two vectors linearly in place.
+ * \param   alpha   The factor of `x`.
+ * \param   x       The vector to scale.
+ * \param   beta    The factor of `y`.
+ * \param   y       The vector to update.
+ * \param   count   The number of components.
+ *
+ * This kernel computes `y = alpha * x + beta * y` in a single pass without any
+ * temporary vector.  If the target supports fused multiply-add instructions,
+ * the product `alpha * x` is added without being rounded first; the scalar
+ * remainder follows the vectorised part such that all components are rounded
+ * alike.
+ */
+
+void kernel_axpby (const float          alpha,
+                   const float *        x,
+                   const float          beta,
+                   float *              y,
+                   const dimension_t    count) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    const __m256 a = _mm256_set1_ps (alpha);
+    const __m256 b = _mm256_set1_ps (beta);
+
+    for (; i + 0x8 <= count; i += 0x8)
+    {
+        const __m256 p = _mm256_mul_ps (b, _mm256_loadu_ps (y + i));
+
+#if defined (__FMA__)
+        _mm256_storeu_ps (y + i, _mm256_fmadd_ps (a, _mm256_loadu_ps (x + i),
+                                                  p));
+#else
+        _mm256_storeu_ps (y + i, _mm256_add_ps (_mm256_mul_ps
+                                                (a, _mm256_loadu_ps (x + i)),
+                                                p));
+#endif  // ! __FMA__
+    };
+#elif defined (__SSE2__)
+    const __m128 a = _mm_set1_ps (alpha);
+    const __m128 b = _mm_set1_ps (beta);
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const __m128 p = _mm_mul_ps (b, _mm_loadu_ps (y + i));
+
+        _mm_storeu_ps (y + i, _mm_add_ps (_mm_mul_ps (a, _mm_loadu_ps (x + i)),
+                                          p));
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+#if defined (__FMA__)
+        y[i] = fma (alpha, x[i], beta * y[i]);
+#else
+        y[i] = alpha * x[i] + beta * y[i];
+#endif  // ! __FMA__
+
+    return;
+}
+
+
+
+/**
+ * \brief   Add a multiple of one vector to another.
+ * \param   alpha   The factor of `x`.
+ * \param   x       The vector to scale.
+ * \param   y       The vector to update.
+ * \param   count   The number of components.
+ *
+ * This is the double precision version of the kernel below.
+ */
+
+void kernel_axpy (const double      alpha,
+                  const double *    x,
+                  double *          y,
+                  const dimension_t count) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    const __m256d a = _mm256_set1_pd (alpha);
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const __m256d p = _mm256_mul_pd (a, _mm256_loadu_pd (x + i));
+
+        _mm256_storeu_pd (y + i, _mm256_add_pd (_mm256_loadu_pd (y + i), p));
+    };
+#elif defined (__SSE2__)
+    const __m128d a = _mm_set1_pd (alpha);
+
+    for (; i + 0x2 <= count; i += 0x2)
+    {
+        const __m128d p = _mm_mul_pd (a, _mm_loadu_pd (x + i));
+
+        _mm_storeu_pd (y + i, _mm_add_pd (_mm_loadu_pd (y + i), p));
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        y[i] += alpha * x[i];
+
+    return;
+}
+
+
+
+/**
+ * \brief   Add a multiple of one vector to another.
+ * \param   alpha   The factor of `x`.
+ * \param   x       The vector to scale.
+ * \param   y       The vector to update.
+ * \param   count   The number of components.
+ *
+ * This kernel computes `y += alpha * x` without any temporary vector.  The
+ * products are rounded before the addition on all targets, such that the
+ * results do not depend on the instruction set.
+ */
+
+void kernel_axpy (const float       alpha,
+                  const float *     x,
+                  float *           y,
+                  const dimension_t count) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    const __m256 a = _mm256_set1_ps (alpha);
+
+    for (; i + 0x8 <= count; i += 0x8)
+    {
+        const __m256 p = _mm256_mul_ps (a, _mm256_loadu_ps (x + i));
+
+        _mm256_storeu_ps (y + i, _mm256_add_ps (_mm256_loadu_ps (y + i), p));
+    };
+#elif defined (__SSE2__)
+    const __m128 a = _mm_set1_ps (alpha);
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const __m128 p = _mm_mul_ps (a, _mm_loadu_ps (x + i));
+
+        _mm_storeu_ps (y + i, _mm_add_ps (_mm_loadu_ps (y + i), p));
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        y[i] += alpha * x[i];
+
+    return;
+}
+
+
+
+/**
+ * \brief   Scale a vector.
+ * \param   alpha   The factor.
+ * \param   x       The vector to scale.
+ * \param   count   The number of components.
+ *
+ * This is the double precision version of the kernel below.
+ */
+
+void kernel_scale (const double alpha, double * x, const dimension_t count)
+    noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    const __m256d a = _mm256_set1_pd (alpha);
+
+    for (; i + 0x4 <= count; i += 0x4)
+        _mm256_storeu_pd (x + i, _mm256_mul_pd (a, _mm256_loadu_pd (x + i)));
+#elif defined (__SSE2__)
+    const __m128d a = _mm_set1_pd (alpha);
+
+    for (; i + 0x2 <= count; i += 0x2)
+        _mm_storeu_pd (x + i, _mm_mul_pd (a, _mm_loadu_pd (x + i)));
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        x[i] *= alpha;
+
+    return;
+}
+
+
+
+/**
+ * \brief   Scale a vector.
+ * \param   alpha   The factor.
+ * \param   x       The vector to scale.
+ * \param   count   The number of components.
+ *
+ * This kernel computes `x *= alpha` in place.
+ */
+
+void kernel_scale (const float alpha, float * x, const dimension_t count)
+    noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    const __m256 a = _mm256_set1_ps (alpha);
+
+    for (; i + 0x8 <= count; i += 0x8)
+        _mm256_storeu_ps (x + i, _mm256_mul_ps (a, _mm256_loadu_ps (x + i)));
+#elif defined (__SSE2__)
+    const __m128 a = _mm_set1_ps (alpha);
+
+    for (; i + 0x4 <= count; i += 0x4)
+        _mm_storeu_ps (x + i, _mm_mul_ps (a, _mm_loadu_ps (x + i)));
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        x[i] *= alpha;
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,473 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The comparison kernels.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernel_compare.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the kernels for exact and approximate comparisons.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Intel intrinsics.
+#if defined (__AVX__) || defined (__SSE2__)
+#include <immintrin.h>
+#endif  // ! __AVX__ || __SSE2__
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: isinf;
+using std :: isnan;
+using std :: max;
+using std :: uint64_t;
+
+
+
+/*
+ * Internal helpers.
+ */
+
+/**
+ * \brief   Compare two components approximately.
+ * \param   a           The first component.
+ * \param   b           The second component.
+ * \param   absolute    The absolute tolerance.
+ * \param   relative    The tolerance relative to the larger magnitude.
+ * \param   ulps        The tolerance in units in the last place.
+ * \return  Whether the components are close to each other.
+ *
+ * Two components are close if their finite difference is within the larger
+ * one of both tolerances or if at most `ulps` representable numbers lie
+ * between them.  NaN is never close to anything.
+ */
+
+static inline bool kernel_close (const float      a,
+                                 const float      b,
+                                 const float      absolute,
+                                 const float      relative,
+                                 const uint32_t   ulps) noexcept
+{
+    if (isnan (a) || isnan (b))
+        return false;
+
+    const float d = abs (a - b);
+
+    if (! isinf (d) && d <= max (absolute, relative * max (abs (a), abs (b))))
+        return true;
+
+    uint32_t x;
+    uint32_t y;
+
+    memcpy (& x, & a, sizeof (x));
+    memcpy (& y, & b, sizeof (y));
+
+    const uint32_t mx = x & 0x7fffffff;
+    const uint32_t my = y & 0x7fffffff;
+    const uint32_t u  = (x ^ y) >> 0x1f ? mx + my
+                                        : (mx > my ? mx - my : my - mx);
+
+    return u <= min (ulps, uint32_t (0x7fffffff));
+}
+
+static inline bool kernel_close (const double     a,
+                                 const double     b,
+                                 const double     absolute,
+                                 const double     relative,
+                                 const uint32_t   ulps) noexcept
+{
+    if (isnan (a) || isnan (b))
+        return false;
+
+    const double d = abs (a - b);
+
+    if (! isinf (d) && d <= max (absolute, relative * max (abs (a), abs (b))))
+        return true;
+
+    uint64_t x;
+    uint64_t y;
+
+    memcpy (& x, & a, sizeof (x));
+    memcpy (& y, & b, sizeof (y));
+
+    const uint64_t mx = x & 0x7fffffffffffffff;
+    const uint64_t my = y & 0x7fffffffffffffff;
+    const uint64_t u  = (x ^ y) >> 0x3f ? mx + my
+                                        : (mx > my ? mx - my : my - mx);
+
+    return u <= ulps;
+}
+
+
+
+#if defined (__AVX2__)
+/**
+ * \brief   Compare eight components approximately.
+ * \param   a           The first components.
+ * \param   b           The second components.
+ * \param   absolute    The absolute tolerance in each lane.
+ * \param   relative    The relative tolerance in each lane.
+ * \param   ulps        The tolerance in units in the last place in each lane.
+ * \return  The mask of the lanes which are close to each other.
+ *
+ * This is the vectorised version of the scalar comparison above.  The
+ * distance in units in the last place is the difference of the magnitudes for
+ * components of the same sign and their sum otherwise; sums beyond the range
+ * of signed integers are rejected.
+ */
+
+static inline __m256 kernel_close (const __m256     a,
+                                   const __m256     b,
+                                   const __m256     absolute,
+                                   const __m256     relative,
+                                   const __m256i    ulps) noexcept
+{
+    const __m256i   sign    = _mm256_set1_epi32 (0x7fffffff);
+    const __m256    mask    = _mm256_castsi256_ps (sign);
+    const __m256    d       = _mm256_and_ps (_mm256_sub_ps (a, b), mask);
+    const __m256    m       = _mm256_max_ps (_mm256_and_ps (a, mask),
+                                             _mm256_and_ps (b, mask));
+    const __m256    tol     = _mm256_max_ps (absolute,
+                                             _mm256_mul_ps (relative, m));
+    const __m256    finite  = _mm256_cmp_ps (d, _mm256_set1_ps (HUGE_VALF),
+                                             _CMP_LT_OQ);
+    const __m256    near    = _mm256_and_ps (_mm256_cmp_ps (d, tol, _CMP_LE_OQ),
+                                             finite);
+
+    const __m256i   x       = _mm256_castps_si256 (a);
+    const __m256i   y       = _mm256_castps_si256 (b);
+    const __m256i   mx      = _mm256_and_si256 (x, sign);
+    const __m256i   my      = _mm256_and_si256 (y, sign);
+    const __m256i   u       = _mm256_blendv_epi8 (
+                                  _mm256_abs_epi32 (_mm256_sub_epi32 (mx, my)),
+                                  _mm256_add_epi32 (mx, my),
+                                  _mm256_srai_epi32 (_mm256_xor_si256 (x, y),
+                                                     0x1f));
+    const __m256i   far     = _mm256_or_si256 (
+                                  _mm256_cmpgt_epi32 (u, ulps),
+                                  _mm256_cmpgt_epi32 (_mm256_setzero_si256 (),
+                                                      u));
+    const __m256    ulp     = _mm256_andnot_ps (_mm256_castsi256_ps (far),
+                                                _mm256_castsi256_ps (
+                                                    _mm256_set1_epi32 (-0x1)));
+
+    return _mm256_and_ps (_mm256_cmp_ps (a, b, _CMP_ORD_Q),
+                          _mm256_or_ps (near, ulp));
+}
+
+
+
+/**
+ * \brief   Compare four components approximately.
+ * \param   a           The first components.
+ * \param   b           The second components.
+ * \param   absolute    The absolute tolerance in each lane.
+ * \param   relative    The relative tolerance in each lane.
+ * \param   ulps        The tolerance in units in the last place in each lane.
+ * \return  The mask of the lanes which are close to each other.
+ *
+ * This is the double precision version of the comparison above.
+ */
+
+static inline __m256d kernel_close (const __m256d    a,
+                                    const __m256d    b,
+                                    const __m256d    absolute,
+                                    const __m256d    relative,
+                                    const __m256i    ulps) noexcept
+{
+    const __m256i   sign    = _mm256_set1_epi64x (0x7fffffffffffffff);
+    const __m256i   zero    = _mm256_setzero_si256 ();
+    const __m256d   mask    = _mm256_castsi256_pd (sign);
+    const __m256d   d       = _mm256_and_pd (_mm256_sub_pd (a, b), mask);
+    const __m256d   m       = _mm256_max_pd (_mm256_and_pd (a, mask),
+                                             _mm256_and_pd (b, mask));
+    const __m256d   tol     = _mm256_max_pd (absolute,
+                                             _mm256_mul_pd (relative, m));
+    const __m256d   finite  = _mm256_cmp_pd (d, _mm256_set1_pd (HUGE_VAL),
+                                             _CMP_LT_OQ);
+    const __m256d   near    = _mm256_and_pd (_mm256_cmp_pd (d, tol, _CMP_LE_OQ),
+                                             finite);
+
+    const __m256i   x       = _mm256_castpd_si256 (a);
+    const __m256i   y       = _mm256_castpd_si256 (b);
+    const __m256i   mx      = _mm256_and_si256 (x, sign);
+    const __m256i   my      = _mm256_and_si256 (y, sign);
+    const __m256i   s       = _mm256_sub_epi64 (mx, my);
+    const __m256i   n       = _mm256_cmpgt_epi64 (zero, s);
+    const __m256i   u       = _mm256_blendv_epi8 (
+                                  _mm256_sub_epi64 (_mm256_xor_si256 (s, n), n),
+                                  _mm256_add_epi64 (mx, my),
+                                  _mm256_cmpgt_epi64 (zero,
+                                                      _mm256_xor_si256 (x, y)));
+    const __m256i   far     = _mm256_or_si256 (_mm256_cmpgt_epi64 (u, ulps),
+                                               _mm256_cmpgt_epi64 (zero, u));
+    const __m256d   ulp     = _mm256_andnot_pd (_mm256_castsi256_pd (far),
+                                                _mm256_castsi256_pd (
+                                                    _mm256_set1_epi64x (-0x1)));
+
+    return _mm256_and_pd (_mm256_cmp_pd (a, b, _CMP_ORD_Q),
+                          _mm256_or_pd (near, ulp));
+}
+#endif  // ! __AVX2__
+
+
+
+/**
+ * \brief   Compare two vectors approximately.
+ * \param   a           The first vector's components.
+ * \param   b           The second vector's components.
+ * \param   count       The number of components.
+ * \param   absolute    The absolute tolerance.
+ * \param   relative    The tolerance relative to the larger magnitude.
+ * \param   ulps        The tolerance in units in the last place.
+ * \return  Whether all components are close to each other.
+ *
+ * This kernel compares eight components at once with AVX2 and returns as soon
+ * as a block contains a component which is not close to its counterpart.
+ */
+
+bool kernel_approx_equal (const float *     a,
+                          const float *     b,
+                          const dimension_t count,
+                          const float       absolute,
+                          const float       relative,
+                          const uint32_t    ulps) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX2__)
+    const __m256    va  = _mm256_set1_ps (absolute);
+    const __m256    vr  = _mm256_set1_ps (relative);
+    const __m256i   vu  = _mm256_set1_epi32 (min (ulps, uint32_t (0x7fffffff)));
+
+    for (; i + 0x8 <= count; i += 0x8)
+        if (_mm256_movemask_ps (kernel_close (_mm256_loadu_ps (a + i),
+                                              _mm256_loadu_ps (b + i),
+                                              va, vr, vu)) != 0xff)
+            return false;
+#endif  // ! __AVX2__
+
+    for (; i < count; i++)
+        if (! kernel_close (a[i], b[i], absolute, relative, ulps))
+            return false;
+
+    return true;
+}
+
+
+
+/**
+ * \brief   Compare two vectors approximately.
+ * \param   a           The first vector's components.
+ * \param   b           The second vector's components.
+ * \param   count       The number of components.
+ * \param   absolute    The absolute tolerance.
+ * \param   relative    The tolerance relative to the larger magnitude.
+ * \param   ulps        The tolerance in units in the last place.
+ * \return  Whether all components are close to each other.
+ *
+ * This is the double precision version of the kernel above, comparing four
+ * components at once.
+ */
+
+bool kernel_approx_equal (const double *    a,
+                          const double *    b,
+                          const dimension_t count,
+                          const double      absolute,
+                          const double      relative,
+                          const uint32_t    ulps) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX2__)
+    const __m256d   va  = _mm256_set1_pd (absolute);
+    const __m256d   vr  = _mm256_set1_pd (relative);
+    const __m256i   vu  = _mm256_set1_epi64x (ulps);
+
+    for (; i + 0x4 <= count; i += 0x4)
+        if (_mm256_movemask_pd (kernel_close (_mm256_loadu_pd (a + i),
+                                              _mm256_loadu_pd (b + i),
+                                              va, vr, vu)) != 0xf)
+            return false;
+#endif  // ! __AVX2__
+
+    for (; i < count; i++)
+        if (! kernel_close (a[i], b[i], absolute, relative, ulps))
+            return false;
+
+    return true;
+}
+
+
+
+/**
+ * \brief   Compare two vectors exactly.
+ * \param   a       The first vector's components.
+ * \param   b       The second vector's components.
+ * \param   count   The number of components.
+ * \return  Whether no component is less or greater than its counterpart.
+ *
+ * This kernel tests 32 components per iteration with AVX and 16 with SSE2 and
+ * returns as soon as a block differs.  Like the scalar comparison, it treats
+ * positive and negative zero as well as NaN and any other number as equal.
+ */
+
+bool kernel_equal (const float * a, const float * b, const dimension_t count)
+    noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    for (; i + 0x20 <= count; i += 0x20)
+    {
+        const __m256 d0 = _mm256_cmp_ps (_mm256_loadu_ps (a + i),
+                                         _mm256_loadu_ps (b + i),
+                                         _CMP_NEQ_OQ);
+        const __m256 d1 = _mm256_cmp_ps (_mm256_loadu_ps (a + i + 0x8),
+                                         _mm256_loadu_ps (b + i + 0x8),
+                                         _CMP_NEQ_OQ);
+        const __m256 d2 = _mm256_cmp_ps (_mm256_loadu_ps (a + i + 0x10),
+                                         _mm256_loadu_ps (b + i + 0x10),
+                                         _CMP_NEQ_OQ);
+        const __m256 d3 = _mm256_cmp_ps (_mm256_loadu_ps (a + i + 0x18),
+                                         _mm256_loadu_ps (b + i + 0x18),
+                                         _CMP_NEQ_OQ);
+
+        if (_mm256_movemask_ps (_mm256_or_ps (_mm256_or_ps (d0, d1),
+                                              _mm256_or_ps (d2, d3))))
+            return false;
+    };
+
+    for (; i + 0x8 <= count; i += 0x8)
+        if (_mm256_movemask_ps (_mm256_cmp_ps (_mm256_loadu_ps (a + i),
+                                               _mm256_loadu_ps (b + i),
+                                               _CMP_NEQ_OQ)))
+            return false;
+#elif defined (__SSE2__)
+    for (; i + 0x10 <= count; i += 0x10)
+    {
+        __m128 d = _mm_setzero_ps ();
+
+        for (dimension_t j = i; j < i + 0x10; j += 0x4)
+        {
+            const __m128 x = _mm_loadu_ps (a + j);
+            const __m128 y = _mm_loadu_ps (b + j);
+
+            d = _mm_or_ps (d, _mm_or_ps (_mm_cmplt_ps (x, y),
+                                         _mm_cmpgt_ps (x, y)));
+        };
+
+        if (_mm_movemask_ps (d))
+            return false;
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        if (a[i] < b[i] || a[i] > b[i])
+            return false;
+
+    return true;
+}
+
+
+
+/**
+ * \brief   Compare two vectors exactly.
+ * \param   a       The first vector's components.
+ * \param   b       The second vector's components.
+ * \param   count   The number of components.
+ * \return  Whether no component is less or greater than its counterpart.
+ *
+ * This is the double precision version of the kernel above.
+ */
+
+bool kernel_equal (const double * a, const double * b, const dimension_t count)
+    noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    for (; i + 0x10 <= count; i += 0x10)
+    {
+        const __m256d d0 = _mm256_cmp_pd (_mm256_loadu_pd (a + i),
+                                          _mm256_loadu_pd (b + i),
+                                          _CMP_NEQ_OQ);
+        const __m256d d1 = _mm256_cmp_pd (_mm256_loadu_pd (a + i + 0x4),
+                                          _mm256_loadu_pd (b + i + 0x4),
+                                          _CMP_NEQ_OQ);
+        const __m256d d2 = _mm256_cmp_pd (_mm256_loadu_pd (a + i + 0x8),
+                                          _mm256_loadu_pd (b + i + 0x8),
+                                          _CMP_NEQ_OQ);
+        const __m256d d3 = _mm256_cmp_pd (_mm256_loadu_pd (a + i + 0xc),
+                                          _mm256_loadu_pd (b + i + 0xc),
+                                          _CMP_NEQ_OQ);
+
+        if (_mm256_movemask_pd (_mm256_or_pd (_mm256_or_pd (d0, d1),
+                                              _mm256_or_pd (d2, d3))))
+            return false;
+    };
+
+    for (; i + 0x4 <= count; i += 0x4)
+        if (_mm256_movemask_pd (_mm256_cmp_pd (_mm256_loadu_pd (a + i),
+                                               _mm256_loadu_pd (b + i),
+                                               _CMP_NEQ_OQ)))
+            return false;
+#elif defined (__SSE2__)
+    for (; i + 0x8 <= count; i += 0x8)
+    {
+        __m128d d = _mm_setzero_pd ();
+
+        for (dimension_t j = i; j < i + 0x8; j += 0x2)
+        {
+            const __m128d x = _mm_loadu_pd (a + j);
+            const __m128d y = _mm_loadu_pd (b + j);
+
+            d = _mm_or_pd (d, _mm_or_pd (_mm_cmplt_pd (x, y),
+                                         _mm_cmpgt_pd (x, y)));
+        };
+
+        if (_mm_movemask_pd (d))
+            return false;
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        if (a[i] < b[i] || a[i] > b[i])
+            return false;
+
+    return true;
+}
+
+/******************************************************************************/
@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The conversion kernels.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernel_convert.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the conversions between the storage precisions.  The
+ * AVX-512 paths use the zero masking intrinsics with a full mask as the
+ * unmasked ones of GCC 12 merge into an uninitialised vector, which breaks
+ * builds with `-Werror`.  The full mask compiles to the unmasked instructions.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// Intel intrinsics.
+#if defined (__AVX2__) || defined (__AVX512F__) || defined (__F16C__)
+#include <immintrin.h>
+#endif  // ! __AVX2__ || __AVX512F__ || __F16C__
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Narrow `float` components to bfloat16.
+ * \param   in      The components to convert.
+ * \param   out     The buffer to write the converted components to.
+ * \param   count   The number of components.
+ *
+ * This kernel rounds each component to the nearest bfloat16 number, ties to
+ * even.  The vectorised paths perform the very same integer rounding as the
+ * scalar conversion such that the results do not depend on the instruction
+ * set.
+ */
+
+void kernel_narrow (const float * in, bfloat16_t * out, const dimension_t count)
+    noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX512F__)
+    const __mmask16 all     = 0xffff;
+    const __m512i   nan     = _mm512_set1_epi32 (0x7f800000);
+    const __m512i   one     = _mm512_set1_epi32 (0x1);
+    const __m512i   quiet   = _mm512_set1_epi32 (0x40);
+    const __m512i   round   = _mm512_set1_epi32 (0x7fff);
+    const __m512i   sign    = _mm512_set1_epi32 (0x7fffffff);
+
+    for (; i + 0x10 <= count; i += 0x10)
+    {
+        const __m512i   x   = _mm512_castps_si512 (_mm512_loadu_ps (in + i));
+        const __m512i   top = _mm512_maskz_srli_epi32 (all, x, 0x10);
+        const __m512i   lsb = _mm512_and_si512 (top, one);
+        const __m512i   rne = _mm512_maskz_srli_epi32 (all, _mm512_add_epi32 (
+                              x, _mm512_add_epi32 (round, lsb)), 0x10);
+        const __m512i   qnn = _mm512_or_si512 (top, quiet);
+        const __mmask16 isn = _mm512_cmpgt_epi32_mask (
+                              _mm512_and_si512 (x, sign), nan);
+
+        _mm512_mask_cvtepi32_storeu_epi16 (out + i, all,
+                                           _mm512_mask_mov_epi32 (rne, isn,
+                                                                  qnn));
+    };
+#elif defined (__AVX2__)
+    const __m256i   nan     = _mm256_set1_epi32 (0x7f800000);
+    const __m256i   one     = _mm256_set1_epi32 (0x1);
+    const __m256i   quiet   = _mm256_set1_epi32 (0x40);
+    const __m256i   round   = _mm256_set1_epi32 (0x7fff);
+    const __m256i   sign    = _mm256_set1_epi32 (0x7fffffff);
+
+    for (; i + 0x8 <= count; i += 0x8)
+    {
+        const __m256i   x   = _mm256_castps_si256 (_mm256_loadu_ps (in + i));
+        const __m256i   top = _mm256_srli_epi32 (x, 0x10);
+        const __m256i   lsb = _mm256_and_si256 (top, one);
+        const __m256i   rne = _mm256_srli_epi32 (_mm256_add_epi32 (x,
+                              _mm256_add_epi32 (round, lsb)), 0x10);
+        const __m256i   qnn = _mm256_or_si256 (top, quiet);
+        const __m256i   isn = _mm256_cmpgt_epi32 (_mm256_and_si256 (x, sign),
+                                                  nan);
+        const __m256i   ret = _mm256_blendv_epi8 (rne, qnn, isn);
+
+        _mm_storeu_si128 ((__m128i *) (out + i), _mm_packus_epi32 (
+                          _mm256_castsi256_si128 (ret),
+                          _mm256_extracti128_si256 (ret, 0x1)));
+    };
+#endif  // ! __AVX512F__ || __AVX2__
+
+    for (; i < count; i++)
+        out[i] = bfloat16_t (in[i]);
+
+    return;
+}
+
+
+
+/**
+ * \brief   Narrow `float` components to half precision.
+ * \param   in      The components to convert.
+ * \param   out     The buffer to write the converted components to.
+ * \param   count   The number of components.
+ *
+ * This kernel rounds each component to the nearest half precision number, ties
+ * to even.  The F16C and AVX-512 conversion instructions are used if the target
+ * supports them.
+ */
+
+void kernel_narrow (const float * in, half_t * out, const dimension_t count)
+    noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX512F__)
+    for (; i + 0x10 <= count; i += 0x10)
+        _mm256_storeu_si256 ((__m256i *) (out + i), _mm512_maskz_cvtps_ph (
+                             0xffff, _mm512_loadu_ps (in + i),
+                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#endif  // ! __AVX512F__
+
+#if defined (__F16C__)
+    for (; i + 0x8 <= count; i += 0x8)
+        _mm_storeu_si128 ((__m128i *) (out + i), _mm256_cvtps_ph (
+                          _mm256_loadu_ps (in + i),
+                          _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#endif  // ! __F16C__
+
+    for (; i < count; i++)
+        out[i] = half_t (in[i]);
+
+    return;
+}
+
+
+
+/**
+ * \brief   Widen bfloat16 components to `float`.
+ * \param   in      The components to convert.
+ * \param   out     The buffer to write the converted components to.
+ * \param   count   The number of components.
+ *
+ * This kernel converts each component losslessly to `float`.
+ */
+
+void kernel_widen (const bfloat16_t * in, float * out, const dimension_t count)
+    noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX512F__)
+    for (; i + 0x10 <= count; i += 0x10)
+        _mm512_storeu_ps (out + i, _mm512_castsi512_ps (
+                          _mm512_maskz_slli_epi32 (0xffff,
+                          _mm512_maskz_cvtepu16_epi32 (0xffff,
+                          _mm256_loadu_si256 ((const __m256i *) (in + i))),
+                          0x10)));
+#endif  // ! __AVX512F__
+
+#if defined (__AVX2__)
+    for (; i + 0x8 <= count; i += 0x8)
+        _mm256_storeu_ps (out + i, _mm256_castsi256_ps (_mm256_slli_epi32 (
+                          _mm256_cvtepu16_epi32 (_mm_loadu_si128 (
+                          (const __m128i *) (in + i))), 0x10)));
+#endif  // ! __AVX2__
+
+    for (; i < count; i++)
+        out[i] = in[i];
+
+    return;
+}
+
+
+
+/**
+ * \brief   Widen half precision components to `float`.
+ * \param   in      The components to convert.
+ * \param   out     The buffer to write the converted components to.
+ * \param   count   The number of components.
+ *
+ * This kernel converts each component losslessly to `float`.  The F16C and
+ * AVX-512 conversion instructions are used if the target supports them.
+ */
+
+void kernel_widen (const half_t * in, float * out, const dimension_t count)
+    noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX512F__)
+    for (; i + 0x10 <= count; i += 0x10)
+        _mm512_storeu_ps (out + i, _mm512_maskz_cvtph_ps (0xffff,
+                          _mm256_loadu_si256 ((const __m256i *) (in + i))));
+#endif  // ! __AVX512F__
+
+#if defined (__F16C__)
+    for (; i + 0x8 <= count; i += 0x8)
+        _mm256_storeu_ps (out + i, _mm256_cvtph_ps (_mm_loadu_si128 (
+                          (const __m128i *) (in + i))));
+#endif  // ! __F16C__
+
+    for (; i < count; i++)
+        out[i] = in[i];
+
+    return;
+}
+
+/******************************************************************************/
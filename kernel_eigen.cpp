@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The eigendecomposition kernel.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernel_eigen.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the kernel which diagonalises symmetric matrices.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: fill;
+using std :: numeric_limits;
+using std :: swap;
+
+
+
+/**
+ * \brief   Diagonalise a symmetric matrix.
+ * \param   a       The matrix to diagonalise, row by row; it is destroyed.
+ * \param   count   The number of rows and columns.
+ * \param   values  The buffer to write the `count` eigenvalues to.
+ * \param   vectors The buffer to write the `count` eigenvectors to, row by row.
+ *
+ * This kernel applies cyclic Jacobi rotations until the off-diagonal elements
+ * vanish relative to the whole matrix.  The method is slower than a reduction
+ * to tridiagonal form but accurate to the last digits, which suits the small
+ * projected matrices it is meant for.  The eigenvalues are sorted in descending
+ * order and the largest component of each eigenvector is positive, such that
+ * the results are reproducible.
+ */
+
+void kernel_eigen (double *             a,
+                   const dimension_t    count,
+                   double *             values,
+                   double *             vectors) noexcept
+{
+    const double epsilon = numeric_limits <double> :: epsilon ();
+
+    fill (vectors, vectors + count * count, 0.0);
+
+    for (dimension_t i = 0x0; i < count; i++)
+        vectors[i * count + i] = 1.0;
+
+    for (dimension_t sweep = 0x0; sweep < 0x40; sweep++)
+    {
+        double off  = 0x0;
+        double all  = 0x0;
+
+        for (dimension_t i = 0x0; i < count; i++)
+            for (dimension_t j = 0x0; j < count; j++)
+            {
+                const double x = a[i * count + j] * a[i * count + j];
+
+                off += i != j ? x : 0x0;
+                all += x;
+            };
+
+        if (off <= epsilon * epsilon * all)
+            break;
+
+        for (dimension_t p = 0x0; p < count; p++)
+            for (dimension_t q = p + 0x1; q < count; q++)
+            {
+                const double apq = a[p * count + q];
+
+                if (apq == 0x0)
+                    continue;
+
+                const double theta  = (a[q * count + q] - a[p * count + p])
+                                    / (0x2 * apq);
+                const double root   = sqrt (theta * theta + 1.0);
+                const double t      = (theta < 0x0 ? - 1.0 : 1.0)
+                                    / (abs (theta) + root);
+                const double c      = 1.0 / sqrt (t * t + 1.0);
+                const double s      = t * c;
+
+                for (dimension_t k = 0x0; k < count; k++)
+                {
+                    const double x = a[k * count + p];
+                    const double y = a[k * count + q];
+
+                    a[k * count + p] = c * x - s * y;
+                    a[k * count + q] = s * x + c * y;
+                };
+
+                for (dimension_t k = 0x0; k < count; k++)
+                {
+                    const double x = a[p * count + k];
+                    const double y = a[q * count + k];
+
+                    a[p * count + k] = c * x - s * y;
+                    a[q * count + k] = s * x + c * y;
+                };
+
+                for (dimension_t k = 0x0; k < count; k++)
+                {
+                    const double x = vectors[p * count + k];
+                    const double y = vectors[q * count + k];
+
+                    vectors[p * count + k] = c * x - s * y;
+                    vectors[q * count + k] = s * x + c * y;
+                };
+            };
+    };
+
+    for (dimension_t i = 0x0; i < count; i++)
+        values[i] = a[i * count + i];
+
+    for (dimension_t i = 0x0; i < count; i++)
+    {
+        dimension_t best = i;
+
+        for (dimension_t j = i + 0x1; j < count; j++)
+            if (values[j] > values[best])
+                best = j;
+
+        swap (values[i], values[best]);
+
+        for (dimension_t k = 0x0; best != i && k < count; k++)
+            swap (vectors[i * count + k], vectors[best * count + k]);
+
+        double * v = vectors + i * count;
+        double   m = 0x0;
+
+        for (dimension_t k = 0x0; k < count; k++)
+            if (abs (v[k]) > abs (m))
+                m = v[k];
+
+        for (dimension_t k = 0x0; m < 0x0 && k < count; k++)
+            v[k] = - v[k];
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,500 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The element-wise kernels.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernel_elementwise.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the kernels which operate on each component on its own.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <cmath>
+
+// Intel intrinsics.
+#if defined (__AVX__) || defined (__SSE2__)
+#include <immintrin.h>
+#endif  // ! __AVX__ || __SSE2__
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: exp;
+
+
+
+/*
+ * Internal helpers.
+ */
+
+#if defined (__SSE2__)
+/**
+ * \brief   The exponential function of four `float` lanes.
+ * \param   x   The exponents.
+ * \return  The powers of Euler's number.
+ *
+ * The exponent is split into `n * ln (2) + r` with an integral `n` and
+ * `|r| <= ln (2) / 2`.  The power of `r` is approximated by a polynomial of
+ * Cephes and scaled by `2 ^ n` by adding `n` to its binary exponent.  The
+ * relative error is about two units in the last place.  Results beyond the
+ * range of normal numbers are flushed to zero or infinity; NaN is passed
+ * through.
+ */
+
+static inline __m128 kernel_exp (const __m128 x) noexcept
+{
+    const __m128    hi  = _mm_set1_ps (88.72283f);
+    const __m128    lo  = _mm_set1_ps (- 87.33654f);
+    const __m128    c   = _mm_min_ps (_mm_max_ps (x, lo), hi);
+    const __m128i   ni  = _mm_cvtps_epi32 (_mm_min_ps (_mm_mul_ps
+                                           (c, _mm_set1_ps (1.44269504f)),
+                                           _mm_set1_ps (127.0f)));
+    const __m128    n   = _mm_cvtepi32_ps (ni);
+    const __m128    r   = _mm_sub_ps (_mm_sub_ps (c, _mm_mul_ps
+                                      (n, _mm_set1_ps (0.693359375f))),
+                                      _mm_mul_ps (n, _mm_set1_ps
+                                                  (- 2.12194440e-4f)));
+    __m128          p   = _mm_set1_ps (1.9875691500e-4f);
+
+    p = _mm_add_ps (_mm_mul_ps (p, r), _mm_set1_ps (1.3981999507e-3f));
+    p = _mm_add_ps (_mm_mul_ps (p, r), _mm_set1_ps (8.3334519073e-3f));
+    p = _mm_add_ps (_mm_mul_ps (p, r), _mm_set1_ps (4.1665795894e-2f));
+    p = _mm_add_ps (_mm_mul_ps (p, r), _mm_set1_ps (1.6666665459e-1f));
+    p = _mm_add_ps (_mm_mul_ps (p, r), _mm_set1_ps (5.0000001201e-1f));
+    p = _mm_add_ps (_mm_add_ps (_mm_mul_ps (p, _mm_mul_ps (r, r)), r),
+                    _mm_set1_ps (1.0f));
+    p = _mm_mul_ps (p, _mm_castsi128_ps (_mm_slli_epi32 (_mm_add_epi32
+                                         (ni, _mm_set1_epi32 (0x7f)), 0x17)));
+
+    const __m128 over   = _mm_cmpgt_ps (x, hi);
+    const __m128 under  = _mm_cmplt_ps (x, lo);
+    const __m128 nan    = _mm_cmpunord_ps (x, x);
+
+    p = _mm_or_ps (_mm_andnot_ps (over, p),
+                   _mm_and_ps (over, _mm_set1_ps (HUGE_VALF)));
+    p = _mm_andnot_ps (under, p);
+    return _mm_or_ps (_mm_andnot_ps (nan, p), _mm_and_ps (nan, x));
+}
+#endif  // ! __SSE2__
+
+
+
+#if defined (__AVX__)
+/**
+ * \brief   The exponential function of eight `float` lanes.
+ * \param   x   The exponents.
+ * \return  The powers of Euler's number.
+ *
+ * Without 256 bit integer instructions, both halves are handled by the SSE2
+ * version above.
+ */
+
+static inline __m256 kernel_exp (const __m256 x) noexcept
+{
+    const __m128 lower = kernel_exp (_mm256_castps256_ps128 (x));
+    const __m128 upper = kernel_exp (_mm256_extractf128_ps (x, 0x1));
+
+    return _mm256_insertf128_ps (_mm256_castps128_ps256 (lower), upper, 0x1);
+}
+#endif  // ! __AVX__
+
+
+
+/*
+ * Kernels.
+ */
+
+/**
+ * \brief   Combine two vectors element by element.
+ * \param   op      The operation to perform.
+ * \param   a       The first operand.
+ * \param   b       The second operand.
+ * \param   out     The buffer to write the results to.
+ * \param   count   The number of components.
+ *
+ * This is the double precision version of the kernel below.
+ */
+
+void kernel_binary (const kernel_op_t   op,
+                    const double *      a,
+                    const double *      b,
+                    double *            out,
+                    const dimension_t   count) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const __m256d   x = _mm256_loadu_pd (a + i);
+        const __m256d   y = _mm256_loadu_pd (b + i);
+        __m256d         z = x;
+
+        switch (op)
+        {
+            case kernel_divide:     z = _mm256_div_pd (x, y);   break;
+            case kernel_maximum:    z = _mm256_max_pd (y, x);   break;
+            case kernel_minimum:    z = _mm256_min_pd (y, x);   break;
+            case kernel_multiply:   z = _mm256_mul_pd (x, y);   break;
+            default:                                            break;
+        };
+
+        _mm256_storeu_pd (out + i, z);
+    };
+#elif defined (__SSE2__)
+    for (; i + 0x2 <= count; i += 0x2)
+    {
+        const __m128d   x = _mm_loadu_pd (a + i);
+        const __m128d   y = _mm_loadu_pd (b + i);
+        __m128d         z = x;
+
+        switch (op)
+        {
+            case kernel_divide:     z = _mm_div_pd (x, y);  break;
+            case kernel_maximum:    z = _mm_max_pd (y, x);  break;
+            case kernel_minimum:    z = _mm_min_pd (y, x);  break;
+            case kernel_multiply:   z = _mm_mul_pd (x, y);  break;
+            default:                                        break;
+        };
+
+        _mm_storeu_pd (out + i, z);
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        switch (op)
+        {
+            case kernel_divide:     out[i] = a[i] / b[i];           break;
+            case kernel_maximum:    out[i] = max (a[i], b[i]);      break;
+            case kernel_minimum:    out[i] = min (a[i], b[i]);      break;
+            case kernel_multiply:   out[i] = a[i] * b[i];           break;
+            default:                out[i] = a[i];                  break;
+        };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Combine two vectors element by element.
+ * \param   op      The operation to perform.
+ * \param   a       The first operand.
+ * \param   b       The second operand.
+ * \param   out     The buffer to write the results to.
+ * \param   count   The number of components.
+ *
+ * This kernel computes the quotients, the maxima, the minima or the products
+ * of the components of both operands.  The minimum and the maximum follow
+ * `std :: min` and `std :: max`, returning the first operand if the components
+ * are unordered.  The output may alias either operand.
+ */
+
+void kernel_binary (const kernel_op_t   op,
+                    const float *       a,
+                    const float *       b,
+                    float *             out,
+                    const dimension_t   count) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    for (; i + 0x8 <= count; i += 0x8)
+    {
+        const __m256    x = _mm256_loadu_ps (a + i);
+        const __m256    y = _mm256_loadu_ps (b + i);
+        __m256          z = x;
+
+        switch (op)
+        {
+            case kernel_divide:     z = _mm256_div_ps (x, y);   break;
+            case kernel_maximum:    z = _mm256_max_ps (y, x);   break;
+            case kernel_minimum:    z = _mm256_min_ps (y, x);   break;
+            case kernel_multiply:   z = _mm256_mul_ps (x, y);   break;
+            default:                                            break;
+        };
+
+        _mm256_storeu_ps (out + i, z);
+    };
+#elif defined (__SSE2__)
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const __m128    x = _mm_loadu_ps (a + i);
+        const __m128    y = _mm_loadu_ps (b + i);
+        __m128          z = x;
+
+        switch (op)
+        {
+            case kernel_divide:     z = _mm_div_ps (x, y);  break;
+            case kernel_maximum:    z = _mm_max_ps (y, x);  break;
+            case kernel_minimum:    z = _mm_min_ps (y, x);  break;
+            case kernel_multiply:   z = _mm_mul_ps (x, y);  break;
+            default:                                        break;
+        };
+
+        _mm_storeu_ps (out + i, z);
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        switch (op)
+        {
+            case kernel_divide:     out[i] = a[i] / b[i];           break;
+            case kernel_maximum:    out[i] = max (a[i], b[i]);      break;
+            case kernel_minimum:    out[i] = min (a[i], b[i]);      break;
+            case kernel_multiply:   out[i] = a[i] * b[i];           break;
+            default:                out[i] = a[i];                  break;
+        };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Clamp a vector element by element.
+ * \param   lower   The lower bound.
+ * \param   upper   The upper bound.
+ * \param   in      The operand.
+ * \param   out     The buffer to write the results to.
+ * \param   count   The number of components.
+ *
+ * This is the double precision version of the kernel below.
+ */
+
+void kernel_clamp (const double         lower,
+                   const double         upper,
+                   const double *       in,
+                   double *             out,
+                   const dimension_t    count) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    const __m256d l = _mm256_set1_pd (lower);
+    const __m256d u = _mm256_set1_pd (upper);
+
+    for (; i + 0x4 <= count; i += 0x4)
+        _mm256_storeu_pd (out + i, _mm256_min_pd (u, _mm256_max_pd
+                                                  (l, _mm256_loadu_pd
+                                                      (in + i))));
+#elif defined (__SSE2__)
+    const __m128d l = _mm_set1_pd (lower);
+    const __m128d u = _mm_set1_pd (upper);
+
+    for (; i + 0x2 <= count; i += 0x2)
+        _mm_storeu_pd (out + i, _mm_min_pd (u, _mm_max_pd (l, _mm_loadu_pd
+                                                              (in + i))));
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        out[i] = in[i] < lower ? lower : upper < in[i] ? upper : in[i];
+
+    return;
+}
+
+
+
+/**
+ * \brief   Clamp a vector element by element.
+ * \param   lower   The lower bound.
+ * \param   upper   The upper bound.
+ * \param   in      The operand.
+ * \param   out     The buffer to write the results to.
+ * \param   count   The number of components.
+ *
+ * This kernel limits each component to the interval between both bounds,
+ * following `std :: clamp`.  NaN is passed through.  The output may alias the
+ * operand.
+ */
+
+void kernel_clamp (const float          lower,
+                   const float          upper,
+                   const float *        in,
+                   float *              out,
+                   const dimension_t    count) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    const __m256 l = _mm256_set1_ps (lower);
+    const __m256 u = _mm256_set1_ps (upper);
+
+    for (; i + 0x8 <= count; i += 0x8)
+        _mm256_storeu_ps (out + i, _mm256_min_ps (u, _mm256_max_ps
+                                                  (l, _mm256_loadu_ps
+                                                      (in + i))));
+#elif defined (__SSE2__)
+    const __m128 l = _mm_set1_ps (lower);
+    const __m128 u = _mm_set1_ps (upper);
+
+    for (; i + 0x4 <= count; i += 0x4)
+        _mm_storeu_ps (out + i, _mm_min_ps (u, _mm_max_ps (l, _mm_loadu_ps
+                                                              (in + i))));
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        out[i] = in[i] < lower ? lower : upper < in[i] ? upper : in[i];
+
+    return;
+}
+
+
+
+/**
+ * \brief   Transform a vector element by element.
+ * \param   op      The operation to perform.
+ * \param   in      The operand.
+ * \param   out     The buffer to write the results to.
+ * \param   count   The number of components.
+ *
+ * This is the double precision version of the kernel below.  The exponential
+ * function is delegated to the standard library.
+ */
+
+void kernel_unary (const kernel_op_t    op,
+                   const double *       in,
+                   double *             out,
+                   const dimension_t    count) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    const __m256d sign = _mm256_set1_pd (- 0.0);
+
+    for (; op != kernel_exponential && i + 0x4 <= count; i += 0x4)
+    {
+        const __m256d x = _mm256_loadu_pd (in + i);
+
+        _mm256_storeu_pd (out + i, op == kernel_absolute
+                                   ? _mm256_andnot_pd (sign, x)
+                                   : op == kernel_square_root
+                                   ? _mm256_sqrt_pd (x) : x);
+    };
+#elif defined (__SSE2__)
+    const __m128d sign = _mm_set1_pd (- 0.0);
+
+    for (; op != kernel_exponential && i + 0x2 <= count; i += 0x2)
+    {
+        const __m128d x = _mm_loadu_pd (in + i);
+
+        _mm_storeu_pd (out + i, op == kernel_absolute
+                                ? _mm_andnot_pd (sign, x)
+                                : op == kernel_square_root
+                                ? _mm_sqrt_pd (x) : x);
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        switch (op)
+        {
+            case kernel_absolute:       out[i] = abs (in[i]);   break;
+            case kernel_exponential:    out[i] = exp (in[i]);   break;
+            case kernel_square_root:    out[i] = sqrt (in[i]);  break;
+            default:                    out[i] = in[i];         break;
+        };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Transform a vector element by element.
+ * \param   op      The operation to perform.
+ * \param   in      The operand.
+ * \param   out     The buffer to write the results to.
+ * \param   count   The number of components.
+ *
+ * This kernel computes the absolute values, the exponential functions or the
+ * square roots of the components.  The exponential function is approximated
+ * in the vector registers; the remaining components are delegated to the
+ * standard library.  The output may alias the operand.
+ */
+
+void kernel_unary (const kernel_op_t    op,
+                   const float *        in,
+                   float *              out,
+                   const dimension_t    count) noexcept
+{
+    dimension_t i = 0x0;
+
+#if defined (__AVX__)
+    const __m256 sign = _mm256_set1_ps (- 0.0f);
+
+    for (; i + 0x8 <= count; i += 0x8)
+    {
+        const __m256    x = _mm256_loadu_ps (in + i);
+        __m256          z = x;
+
+        switch (op)
+        {
+            case kernel_absolute:       z = _mm256_andnot_ps (sign, x); break;
+            case kernel_exponential:    z = kernel_exp (x);             break;
+            case kernel_square_root:    z = _mm256_sqrt_ps (x);         break;
+            default:                                                    break;
+        };
+
+        _mm256_storeu_ps (out + i, z);
+    };
+#elif defined (__SSE2__)
+    const __m128 sign = _mm_set1_ps (- 0.0f);
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const __m128    x = _mm_loadu_ps (in + i);
+        __m128          z = x;
+
+        switch (op)
+        {
+            case kernel_absolute:       z = _mm_andnot_ps (sign, x);    break;
+            case kernel_exponential:    z = kernel_exp (x);             break;
+            case kernel_square_root:    z = _mm_sqrt_ps (x);            break;
+            default:                                                    break;
+        };
+
+        _mm_storeu_ps (out + i, z);
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        switch (op)
+        {
+            case kernel_absolute:       out[i] = abs (in[i]);   break;
+            case kernel_exponential:    out[i] = exp (in[i]);   break;
+            case kernel_square_root:    out[i] = sqrt (in[i]);  break;
+            default:                    out[i] = in[i];         break;
+        };
+
+    return;
+}
+
+/******************************************************************************/
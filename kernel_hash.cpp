@@ -0,0 +1,355 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The hashing kernels.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernel_hash.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the kernels for content hashes.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// Intel intrinsics.
+#if defined (__AVX__) || defined (__SSE2__)
+#include <immintrin.h>
+#endif  // ! __AVX__ || __SSE2__
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: isnan;
+using std :: numeric_limits;
+
+
+
+/*
+ * Internal constants.
+ */
+
+/**
+ * \brief   The keys the lanes are mixed with.
+ *
+ * Each lane of the accumulator mixes its input with its own key.  The keys are
+ * advanced by `kernel_hash_step` after each stripe such that the order of the
+ * stripes affects the hash.
+ */
+
+static const uint64_t kernel_hash_keys [kernel_hash_lanes] =
+{
+    0x9e3779b185ebca87, 0xc2b2ae3d27d4eb4f, 0x165667b19e3779f9,
+    0x85ebca77c2b2ae63
+};
+
+static const uint64_t kernel_hash_step = 0x27d4eb2f165667c5;
+
+
+
+/*
+ * Internal helpers.
+ */
+
+/**
+ * \brief   Mix the bits of a 64 bit integer.
+ * \param   x   The integer to mix.
+ * \return  The mixed integer.
+ *
+ * This is the finaliser of MurmurHash3 which lets each input bit affect each
+ * output bit.
+ */
+
+static inline uint64_t kernel_hash_mix (uint64_t x) noexcept
+{
+    x ^= x >> 0x21;
+    x *= 0xff51afd7ed558ccd;
+    x ^= x >> 0x21;
+    x *= 0xc4ceb9fe1a85ec53;
+    x ^= x >> 0x21;
+
+    return x;
+}
+
+
+
+/*
+ * Kernels.
+ */
+
+/**
+ * \brief   Canonicalise `double` components.
+ * \param   in      The components to canonicalise.
+ * \param   out     The buffer to write the canonical components to.
+ * \param   count   The number of components.
+ *
+ * This kernel replaces negative zero by positive zero and each NaN by the same
+ * quiet NaN such that equal components are represented by equal bits.  Adding
+ * positive zero maps negative zero to positive zero and keeps all other
+ * numbers.
+ */
+
+void kernel_canonicalise (const double *    in,
+                          double *          out,
+                          const dimension_t count) noexcept
+{
+    const double    nan = numeric_limits <double> :: quiet_NaN ();
+    dimension_t     i   = 0x0;
+
+#if defined (__AVX__)
+    const __m256d vnan = _mm256_set1_pd (nan);
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const __m256d x = _mm256_loadu_pd (in + i);
+
+        _mm256_storeu_pd (out + i,
+                          _mm256_blendv_pd (
+                              _mm256_add_pd (x, _mm256_setzero_pd ()), vnan,
+                              _mm256_cmp_pd (x, x, _CMP_UNORD_Q)));
+    };
+#elif defined (__SSE2__)
+    const __m128d vnan = _mm_set1_pd (nan);
+
+    for (; i + 0x2 <= count; i += 0x2)
+    {
+        const __m128d x = _mm_loadu_pd (in + i);
+        const __m128d m = _mm_cmpunord_pd (x, x);
+
+        _mm_storeu_pd (out + i,
+                       _mm_or_pd (_mm_and_pd (m, vnan),
+                                  _mm_andnot_pd (m, _mm_add_pd (x,
+                                                     _mm_setzero_pd ()))));
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        out[i] = isnan (in[i]) ? nan : in[i] + 0x0;
+
+    return;
+}
+
+
+
+/**
+ * \brief   Canonicalise `float` components.
+ * \param   in      The components to canonicalise.
+ * \param   out     The buffer to write the canonical components to.
+ * \param   count   The number of components.
+ *
+ * This is the single precision version of the kernel above.
+ */
+
+void kernel_canonicalise (const float *     in,
+                          float *           out,
+                          const dimension_t count) noexcept
+{
+    const float nan = numeric_limits <float> :: quiet_NaN ();
+    dimension_t i   = 0x0;
+
+#if defined (__AVX__)
+    const __m256 vnan = _mm256_set1_ps (nan);
+
+    for (; i + 0x8 <= count; i += 0x8)
+    {
+        const __m256 x = _mm256_loadu_ps (in + i);
+
+        _mm256_storeu_ps (out + i,
+                          _mm256_blendv_ps (
+                              _mm256_add_ps (x, _mm256_setzero_ps ()), vnan,
+                              _mm256_cmp_ps (x, x, _CMP_UNORD_Q)));
+    };
+#elif defined (__SSE2__)
+    const __m128 vnan = _mm_set1_ps (nan);
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const __m128 x = _mm_loadu_ps (in + i);
+        const __m128 m = _mm_cmpunord_ps (x, x);
+
+        _mm_storeu_ps (out + i,
+                       _mm_or_ps (_mm_and_ps (m, vnan),
+                                  _mm_andnot_ps (m, _mm_add_ps (x,
+                                                    _mm_setzero_ps ()))));
+    };
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        out[i] = isnan (in[i]) ? nan : in[i] + 0x0;
+
+    return;
+}
+
+
+
+/**
+ * \brief   The content hash of raw memory.
+ * \param   data    The memory to hash.
+ * \param   bytes   The number of bytes.
+ * \param   seed    The seed to start with.
+ * \return  The hash.
+ *
+ * This kernel hashes the given bytes stripe by stripe.
+ */
+
+uint64_t kernel_hash (const void *      data,
+                      const dimension_t bytes,
+                      const uint64_t    seed) noexcept
+{
+    const dimension_t   stripes = bytes / kernel_hash_stripe;
+    uint64_t            acc [kernel_hash_lanes];
+
+    kernel_hash_init    (acc, seed);
+    kernel_hash_update  (acc, data, stripes, 0x0);
+
+    return kernel_hash_final (acc,
+                              (const unsigned char *) data
+                                  + stripes * kernel_hash_stripe,
+                              bytes % kernel_hash_stripe, bytes, stripes);
+}
+
+
+
+/**
+ * \brief   Finish a content hash.
+ * \param   acc     The accumulator.
+ * \param   tail    The bytes after the last complete stripe.
+ * \param   bytes   The number of bytes after the last complete stripe.
+ * \param   length  The total number of bytes hashed.
+ * \param   stripes The total number of complete stripes hashed.
+ * \return  The hash.
+ *
+ * The tail is padded with zeros to a complete stripe.  The length is mixed in
+ * such that inputs which only differ by trailing zeros do not collide.
+ */
+
+uint64_t kernel_hash_final (uint64_t *          acc,
+                            const void *        tail,
+                            const dimension_t   bytes,
+                            const dimension_t   length,
+                            const dimension_t   stripes) noexcept
+{
+    if (bytes)
+    {
+        unsigned char stripe [kernel_hash_stripe] = { 0x0 };
+
+        memcpy (stripe, tail, bytes);
+        kernel_hash_update (acc, stripe, 0x1, stripes);
+    };
+
+    uint64_t ret = kernel_hash_mix (length * kernel_hash_step);
+
+    for (dimension_t j = 0x0; j < kernel_hash_lanes; j++)
+        ret = kernel_hash_mix (ret ^ acc[j]) * kernel_hash_keys[j];
+
+    return kernel_hash_mix (ret);
+}
+
+
+
+/**
+ * \brief   Start a content hash.
+ * \param   acc     The accumulator.
+ * \param   seed    The seed to start with.
+ */
+
+void kernel_hash_init (uint64_t * acc, const uint64_t seed) noexcept
+{
+    for (dimension_t j = 0x0; j < kernel_hash_lanes; j++)
+        acc[j] = kernel_hash_mix (seed + j) ^ kernel_hash_keys[j];
+
+    return;
+}
+
+
+
+/**
+ * \brief   Feed complete stripes into a content hash.
+ * \param   acc     The accumulator.
+ * \param   data    The stripes to hash.
+ * \param   count   The number of stripes.
+ * \param   offset  The number of stripes hashed before.
+ *
+ * Each lane adds its input to the neighbouring lane and the product of the low
+ * and the high half of its input mixed with the current key to itself.  All
+ * instruction sets compute the same hash.
+ */
+
+void kernel_hash_update (uint64_t *         acc,
+                         const void *       data,
+                         const dimension_t  count,
+                         const dimension_t  offset) noexcept
+{
+    const unsigned char *   in  = (const unsigned char *) data;
+    dimension_t             i   = 0x0;
+
+#if defined (__AVX2__)
+    const __m256i   step    = _mm256_set1_epi64x (kernel_hash_step);
+    __m256i         a       = _mm256_loadu_si256 ((const __m256i *) acc);
+    __m256i         key     = _mm256_add_epi64 (
+                                  _mm256_loadu_si256 (
+                                      (const __m256i *) kernel_hash_keys),
+                                  _mm256_set1_epi64x (kernel_hash_step
+                                                      * offset));
+
+    for (; i < count; i++, in += kernel_hash_stripe)
+    {
+        const __m256i v = _mm256_loadu_si256 ((const __m256i *) in);
+        const __m256i k = _mm256_xor_si256 (v, key);
+
+        a   = _mm256_add_epi64 (a, _mm256_shuffle_epi32 (v, 0x4e));
+        a   = _mm256_add_epi64 (a, _mm256_mul_epu32 (k,
+                                       _mm256_srli_epi64 (k, 0x20)));
+        key = _mm256_add_epi64 (key, step);
+    };
+
+    _mm256_storeu_si256 ((__m256i *) acc, a);
+#endif  // ! __AVX2__
+
+    for (; i < count; i++, in += kernel_hash_stripe)
+        for (dimension_t j = 0x0; j < kernel_hash_lanes; j++)
+        {
+            uint64_t v;
+
+            memcpy (& v, in + j * sizeof (v), sizeof (v));
+
+            const uint64_t k = v ^ (kernel_hash_keys[j]
+                                 + kernel_hash_step * (offset + i));
+
+            acc[j ^ 0x1]    += v;
+            acc[j]          += (k & 0xffffffff) * (k >> 0x20);
+        };
+
+    return;
+}
+
+/******************************************************************************/
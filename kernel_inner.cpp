@@ -0,0 +1,784 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The inner product kernels.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernel_inner.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the kernels for inner products and distances.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// Intel intrinsics.
+#if defined (__AVX__) || defined (__SSE2__)
+#include <immintrin.h>
+#endif  // ! __AVX__ || __SSE2__
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/*
+ * Internal helpers.
+ */
+
+#if defined (__AVX__)
+/**
+ * \brief   Add up the lanes of an AVX register.
+ * \param   x   The register to reduce.
+ * \return  The sum of all lanes.
+ */
+
+static inline float kernel_sum (const __m256 x) noexcept
+{
+    const __m128 h = _mm_add_ps (_mm256_castps256_ps128 (x),
+                                 _mm256_extractf128_ps (x, 0x1));
+    const __m128 q = _mm_add_ps (h, _mm_movehl_ps (h, h));
+
+    return _mm_cvtss_f32 (_mm_add_ss (q, _mm_shuffle_ps (q, q, 0x1)));
+}
+
+static inline double kernel_sum (const __m256d x) noexcept
+{
+    const __m128d h = _mm_add_pd (_mm256_castpd256_pd128 (x),
+                                  _mm256_extractf128_pd (x, 0x1));
+
+    return _mm_cvtsd_f64 (_mm_add_sd (h, _mm_unpackhi_pd (h, h)));
+}
+
+
+
+/**
+ * \brief   Multiply and accumulate.
+ * \param   a   The first factor.
+ * \param   b   The second factor.
+ * \param   c   The summand.
+ * \return  `a * b + c`.
+ *
+ * A fused multiply-add instruction is used if the target supports it.
+ */
+
+static inline __m256 kernel_fmadd (const __m256 a, const __m256 b,
+                                   const __m256 c) noexcept
+{
+#if defined (__FMA__)
+    return _mm256_fmadd_ps (a, b, c);
+#else
+    return _mm256_add_ps (_mm256_mul_ps (a, b), c);
+#endif  // ! __FMA__
+}
+
+static inline __m256d kernel_fmadd (const __m256d a, const __m256d b,
+                                    const __m256d c) noexcept
+{
+#if defined (__FMA__)
+    return _mm256_fmadd_pd (a, b, c);
+#else
+    return _mm256_add_pd (_mm256_mul_pd (a, b), c);
+#endif  // ! __FMA__
+}
+#elif defined (__SSE2__)
+/**
+ * \brief   Add up the lanes of an SSE register.
+ * \param   x   The register to reduce.
+ * \return  The sum of all lanes.
+ */
+
+static inline float kernel_sum (const __m128 x) noexcept
+{
+    const __m128 q = _mm_add_ps (x, _mm_movehl_ps (x, x));
+
+    return _mm_cvtss_f32 (_mm_add_ss (q, _mm_shuffle_ps (q, q, 0x1)));
+}
+
+static inline double kernel_sum (const __m128d x) noexcept
+{
+    return _mm_cvtsd_f64 (_mm_add_sd (x, _mm_unpackhi_pd (x, x)));
+}
+#endif  // ! __AVX__ || __SSE2__
+
+
+
+/**
+ * \brief   The squared Euclidean distance of two vectors.
+ * \param   a       The first vector's components.
+ * \param   b       The second vector's components.
+ * \param   count   The number of components.
+ * \return  The squared Euclidean distance.
+ *
+ * This is the double precision version of the kernel below.
+ */
+
+double kernel_distance_squared (const double *    a,
+                                const double *    b,
+                                const dimension_t count) noexcept
+{
+    dimension_t i   = 0x0;
+    double      ret = 0x0;
+
+#if defined (__AVX__)
+    __m256d s0 = _mm256_setzero_pd ();
+    __m256d s1 = _mm256_setzero_pd ();
+    __m256d s2 = _mm256_setzero_pd ();
+    __m256d s3 = _mm256_setzero_pd ();
+
+    for (; i + 0x10 <= count; i += 0x10)
+    {
+        const __m256d d0 = _mm256_sub_pd (_mm256_loadu_pd (a + i),
+                                          _mm256_loadu_pd (b + i));
+        const __m256d d1 = _mm256_sub_pd (_mm256_loadu_pd (a + i + 0x4),
+                                          _mm256_loadu_pd (b + i + 0x4));
+        const __m256d d2 = _mm256_sub_pd (_mm256_loadu_pd (a + i + 0x8),
+                                          _mm256_loadu_pd (b + i + 0x8));
+        const __m256d d3 = _mm256_sub_pd (_mm256_loadu_pd (a + i + 0xc),
+                                          _mm256_loadu_pd (b + i + 0xc));
+
+        s0 = kernel_fmadd (d0, d0, s0);
+        s1 = kernel_fmadd (d1, d1, s1);
+        s2 = kernel_fmadd (d2, d2, s2);
+        s3 = kernel_fmadd (d3, d3, s3);
+    };
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const __m256d d = _mm256_sub_pd (_mm256_loadu_pd (a + i),
+                                         _mm256_loadu_pd (b + i));
+
+        s0 = kernel_fmadd (d, d, s0);
+    };
+
+    ret = kernel_sum (_mm256_add_pd (_mm256_add_pd (s0, s1),
+                                     _mm256_add_pd (s2, s3)));
+#elif defined (__SSE2__)
+    __m128d s0 = _mm_setzero_pd ();
+    __m128d s1 = _mm_setzero_pd ();
+    __m128d s2 = _mm_setzero_pd ();
+    __m128d s3 = _mm_setzero_pd ();
+
+    for (; i + 0x8 <= count; i += 0x8)
+    {
+        const __m128d d0 = _mm_sub_pd (_mm_loadu_pd (a + i),
+                                       _mm_loadu_pd (b + i));
+        const __m128d d1 = _mm_sub_pd (_mm_loadu_pd (a + i + 0x2),
+                                       _mm_loadu_pd (b + i + 0x2));
+        const __m128d d2 = _mm_sub_pd (_mm_loadu_pd (a + i + 0x4),
+                                       _mm_loadu_pd (b + i + 0x4));
+        const __m128d d3 = _mm_sub_pd (_mm_loadu_pd (a + i + 0x6),
+                                       _mm_loadu_pd (b + i + 0x6));
+
+        s0 = _mm_add_pd (s0, _mm_mul_pd (d0, d0));
+        s1 = _mm_add_pd (s1, _mm_mul_pd (d1, d1));
+        s2 = _mm_add_pd (s2, _mm_mul_pd (d2, d2));
+        s3 = _mm_add_pd (s3, _mm_mul_pd (d3, d3));
+    };
+
+    ret = kernel_sum (_mm_add_pd (_mm_add_pd (s0, s1), _mm_add_pd (s2, s3)));
+#else
+    double s0 = 0x0;
+    double s1 = 0x0;
+    double s2 = 0x0;
+    double s3 = 0x0;
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const double d0 = a[i]       - b[i];
+        const double d1 = a[i + 0x1] - b[i + 0x1];
+        const double d2 = a[i + 0x2] - b[i + 0x2];
+        const double d3 = a[i + 0x3] - b[i + 0x3];
+
+        s0 += d0 * d0;
+        s1 += d1 * d1;
+        s2 += d2 * d2;
+        s3 += d3 * d3;
+    };
+
+    ret = (s0 + s1) + (s2 + s3);
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        ret += (a[i] - b[i]) * (a[i] - b[i]);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   The squared Euclidean distance of two vectors.
+ * \param   a       The first vector's components.
+ * \param   b       The second vector's components.
+ * \param   count   The number of components.
+ * \return  The squared Euclidean distance.
+ *
+ * This kernel sums the squared differences of the components using four
+ * independent accumulators in order to hide the latency of the additions.
+ */
+
+float kernel_distance_squared (const float *     a,
+                               const float *     b,
+                               const dimension_t count) noexcept
+{
+    dimension_t i   = 0x0;
+    float       ret = 0x0;
+
+#if defined (__AVX__)
+    __m256 s0 = _mm256_setzero_ps ();
+    __m256 s1 = _mm256_setzero_ps ();
+    __m256 s2 = _mm256_setzero_ps ();
+    __m256 s3 = _mm256_setzero_ps ();
+
+    for (; i + 0x20 <= count; i += 0x20)
+    {
+        const __m256 d0 = _mm256_sub_ps (_mm256_loadu_ps (a + i),
+                                         _mm256_loadu_ps (b + i));
+        const __m256 d1 = _mm256_sub_ps (_mm256_loadu_ps (a + i + 0x8),
+                                         _mm256_loadu_ps (b + i + 0x8));
+        const __m256 d2 = _mm256_sub_ps (_mm256_loadu_ps (a + i + 0x10),
+                                         _mm256_loadu_ps (b + i + 0x10));
+        const __m256 d3 = _mm256_sub_ps (_mm256_loadu_ps (a + i + 0x18),
+                                         _mm256_loadu_ps (b + i + 0x18));
+
+        s0 = kernel_fmadd (d0, d0, s0);
+        s1 = kernel_fmadd (d1, d1, s1);
+        s2 = kernel_fmadd (d2, d2, s2);
+        s3 = kernel_fmadd (d3, d3, s3);
+    };
+
+    for (; i + 0x8 <= count; i += 0x8)
+    {
+        const __m256 d = _mm256_sub_ps (_mm256_loadu_ps (a + i),
+                                        _mm256_loadu_ps (b + i));
+
+        s0 = kernel_fmadd (d, d, s0);
+    };
+
+    ret = kernel_sum (_mm256_add_ps (_mm256_add_ps (s0, s1),
+                                     _mm256_add_ps (s2, s3)));
+#elif defined (__SSE2__)
+    __m128 s0 = _mm_setzero_ps ();
+    __m128 s1 = _mm_setzero_ps ();
+    __m128 s2 = _mm_setzero_ps ();
+    __m128 s3 = _mm_setzero_ps ();
+
+    for (; i + 0x10 <= count; i += 0x10)
+    {
+        const __m128 d0 = _mm_sub_ps (_mm_loadu_ps (a + i),
+                                      _mm_loadu_ps (b + i));
+        const __m128 d1 = _mm_sub_ps (_mm_loadu_ps (a + i + 0x4),
+                                      _mm_loadu_ps (b + i + 0x4));
+        const __m128 d2 = _mm_sub_ps (_mm_loadu_ps (a + i + 0x8),
+                                      _mm_loadu_ps (b + i + 0x8));
+        const __m128 d3 = _mm_sub_ps (_mm_loadu_ps (a + i + 0xc),
+                                      _mm_loadu_ps (b + i + 0xc));
+
+        s0 = _mm_add_ps (s0, _mm_mul_ps (d0, d0));
+        s1 = _mm_add_ps (s1, _mm_mul_ps (d1, d1));
+        s2 = _mm_add_ps (s2, _mm_mul_ps (d2, d2));
+        s3 = _mm_add_ps (s3, _mm_mul_ps (d3, d3));
+    };
+
+    ret = kernel_sum (_mm_add_ps (_mm_add_ps (s0, s1), _mm_add_ps (s2, s3)));
+#else
+    float s0 = 0x0;
+    float s1 = 0x0;
+    float s2 = 0x0;
+    float s3 = 0x0;
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const float d0 = a[i]       - b[i];
+        const float d1 = a[i + 0x1] - b[i + 0x1];
+        const float d2 = a[i + 0x2] - b[i + 0x2];
+        const float d3 = a[i + 0x3] - b[i + 0x3];
+
+        s0 += d0 * d0;
+        s1 += d1 * d1;
+        s2 += d2 * d2;
+        s3 += d3 * d3;
+    };
+
+    ret = (s0 + s1) + (s2 + s3);
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        ret += (a[i] - b[i]) * (a[i] - b[i]);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   The inner product of two vectors.
+ * \param   a       The first vector's components.
+ * \param   b       The second vector's components.
+ * \param   count   The number of components.
+ * \return  The inner product.
+ *
+ * This is the double precision version of the kernel below.
+ */
+
+double kernel_inner (const double *    a,
+                     const double *    b,
+                     const dimension_t count) noexcept
+{
+    dimension_t i   = 0x0;
+    double      ret = 0x0;
+
+#if defined (__AVX__)
+    __m256d s0 = _mm256_setzero_pd ();
+    __m256d s1 = _mm256_setzero_pd ();
+    __m256d s2 = _mm256_setzero_pd ();
+    __m256d s3 = _mm256_setzero_pd ();
+
+    for (; i + 0x10 <= count; i += 0x10)
+    {
+        s0 = kernel_fmadd (_mm256_loadu_pd (a + i),
+                           _mm256_loadu_pd (b + i), s0);
+        s1 = kernel_fmadd (_mm256_loadu_pd (a + i + 0x4),
+                           _mm256_loadu_pd (b + i + 0x4), s1);
+        s2 = kernel_fmadd (_mm256_loadu_pd (a + i + 0x8),
+                           _mm256_loadu_pd (b + i + 0x8), s2);
+        s3 = kernel_fmadd (_mm256_loadu_pd (a + i + 0xc),
+                           _mm256_loadu_pd (b + i + 0xc), s3);
+    };
+
+    for (; i + 0x4 <= count; i += 0x4)
+        s0 = kernel_fmadd (_mm256_loadu_pd (a + i),
+                           _mm256_loadu_pd (b + i), s0);
+
+    ret = kernel_sum (_mm256_add_pd (_mm256_add_pd (s0, s1),
+                                     _mm256_add_pd (s2, s3)));
+#elif defined (__SSE2__)
+    __m128d s0 = _mm_setzero_pd ();
+    __m128d s1 = _mm_setzero_pd ();
+    __m128d s2 = _mm_setzero_pd ();
+    __m128d s3 = _mm_setzero_pd ();
+
+    for (; i + 0x8 <= count; i += 0x8)
+    {
+        s0 = _mm_add_pd (s0, _mm_mul_pd (_mm_loadu_pd (a + i),
+                                         _mm_loadu_pd (b + i)));
+        s1 = _mm_add_pd (s1, _mm_mul_pd (_mm_loadu_pd (a + i + 0x2),
+                                         _mm_loadu_pd (b + i + 0x2)));
+        s2 = _mm_add_pd (s2, _mm_mul_pd (_mm_loadu_pd (a + i + 0x4),
+                                         _mm_loadu_pd (b + i + 0x4)));
+        s3 = _mm_add_pd (s3, _mm_mul_pd (_mm_loadu_pd (a + i + 0x6),
+                                         _mm_loadu_pd (b + i + 0x6)));
+    };
+
+    ret = kernel_sum (_mm_add_pd (_mm_add_pd (s0, s1), _mm_add_pd (s2, s3)));
+#else
+    double s0 = 0x0;
+    double s1 = 0x0;
+    double s2 = 0x0;
+    double s3 = 0x0;
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        s0 += a[i]       * b[i];
+        s1 += a[i + 0x1] * b[i + 0x1];
+        s2 += a[i + 0x2] * b[i + 0x2];
+        s3 += a[i + 0x3] * b[i + 0x3];
+    };
+
+    ret = (s0 + s1) + (s2 + s3);
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        ret += a[i] * b[i];
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   The inner product of two vectors.
+ * \param   a       The first vector's components.
+ * \param   b       The second vector's components.
+ * \param   count   The number of components.
+ * \return  The inner product.
+ *
+ * This kernel sums the products of the components using four independent
+ * accumulators in order to hide the latency of the additions.
+ */
+
+float kernel_inner (const float *     a,
+                    const float *     b,
+                    const dimension_t count) noexcept
+{
+    dimension_t i   = 0x0;
+    float       ret = 0x0;
+
+#if defined (__AVX__)
+    __m256 s0 = _mm256_setzero_ps ();
+    __m256 s1 = _mm256_setzero_ps ();
+    __m256 s2 = _mm256_setzero_ps ();
+    __m256 s3 = _mm256_setzero_ps ();
+
+    for (; i + 0x20 <= count; i += 0x20)
+    {
+        s0 = kernel_fmadd (_mm256_loadu_ps (a + i),
+                           _mm256_loadu_ps (b + i), s0);
+        s1 = kernel_fmadd (_mm256_loadu_ps (a + i + 0x8),
+                           _mm256_loadu_ps (b + i + 0x8), s1);
+        s2 = kernel_fmadd (_mm256_loadu_ps (a + i + 0x10),
+                           _mm256_loadu_ps (b + i + 0x10), s2);
+        s3 = kernel_fmadd (_mm256_loadu_ps (a + i + 0x18),
+                           _mm256_loadu_ps (b + i + 0x18), s3);
+    };
+
+    for (; i + 0x8 <= count; i += 0x8)
+        s0 = kernel_fmadd (_mm256_loadu_ps (a + i),
+                           _mm256_loadu_ps (b + i), s0);
+
+    ret = kernel_sum (_mm256_add_ps (_mm256_add_ps (s0, s1),
+                                     _mm256_add_ps (s2, s3)));
+#elif defined (__SSE2__)
+    __m128 s0 = _mm_setzero_ps ();
+    __m128 s1 = _mm_setzero_ps ();
+    __m128 s2 = _mm_setzero_ps ();
+    __m128 s3 = _mm_setzero_ps ();
+
+    for (; i + 0x10 <= count; i += 0x10)
+    {
+        s0 = _mm_add_ps (s0, _mm_mul_ps (_mm_loadu_ps (a + i),
+                                         _mm_loadu_ps (b + i)));
+        s1 = _mm_add_ps (s1, _mm_mul_ps (_mm_loadu_ps (a + i + 0x4),
+                                         _mm_loadu_ps (b + i + 0x4)));
+        s2 = _mm_add_ps (s2, _mm_mul_ps (_mm_loadu_ps (a + i + 0x8),
+                                         _mm_loadu_ps (b + i + 0x8)));
+        s3 = _mm_add_ps (s3, _mm_mul_ps (_mm_loadu_ps (a + i + 0xc),
+                                         _mm_loadu_ps (b + i + 0xc)));
+    };
+
+    ret = kernel_sum (_mm_add_ps (_mm_add_ps (s0, s1), _mm_add_ps (s2, s3)));
+#else
+    float s0 = 0x0;
+    float s1 = 0x0;
+    float s2 = 0x0;
+    float s3 = 0x0;
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        s0 += a[i]       * b[i];
+        s1 += a[i + 0x1] * b[i + 0x1];
+        s2 += a[i + 0x2] * b[i + 0x2];
+        s3 += a[i + 0x3] * b[i + 0x3];
+    };
+
+    ret = (s0 + s1) + (s2 + s3);
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        ret += a[i] * b[i];
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   The inner product of two vectors of 8 bit integers.
+ * \param   a       The first vector's components.
+ * \param   b       The second vector's components.
+ * \param   count   The number of components.
+ * \return  The exact inner product.
+ *
+ * This kernel is meant for quantised components within [-127, 127].  With
+ * AVX-512 VNNI or AVX-VNNI, the first operand is biased by 128 to become
+ * unsigned and the bias is subtracted again afterwards.  With AVX2, the
+ * absolute values of the first operand are multiplied with the second one
+ * after transferring the signs, which cannot saturate the 16 bit intermediate
+ * sums for components within the intended range.  The AVX-512 sums are reduced
+ * by hand with zero masked extractions, as the reduction and cast intrinsics of
+ * GCC 12 read an uninitialised vector and break builds with `-Werror`.
+ */
+
+int32_t kernel_inner (const int8_t *    a,
+                      const int8_t *    b,
+                      const dimension_t count) noexcept
+{
+    dimension_t i   = 0x0;
+    int32_t     ret = 0x0;
+
+#if defined (__AVX512VNNI__) && defined (__AVX512BW__)
+    const __m512i   bias    = _mm512_set1_epi8 (-0x80);
+    __m512i         sum     = _mm512_setzero_si512 ();
+    __m512i         offset  = _mm512_setzero_si512 ();
+
+    for (; i + 0x40 <= count; i += 0x40)
+    {
+        const __m512i x = _mm512_loadu_si512 ((const void *) (a + i));
+        const __m512i y = _mm512_loadu_si512 ((const void *) (b + i));
+
+        sum     = _mm512_dpbusd_epi32 (sum, _mm512_xor_si512 (x, bias), y);
+        offset  = _mm512_dpbusd_epi32 (offset, bias, y);
+    };
+
+    const __m512i   d = _mm512_sub_epi32 (sum, offset);
+    const __m256i   e = _mm256_add_epi32 (
+                        _mm512_maskz_extracti64x4_epi64 (0xf, d, 0x0),
+                        _mm512_maskz_extracti64x4_epi64 (0xf, d, 0x1));
+    const __m128i   h = _mm_add_epi32 (_mm256_castsi256_si128 (e),
+                                       _mm256_extracti128_si256 (e, 0x1));
+    const __m128i   q = _mm_add_epi32 (h, _mm_unpackhi_epi64 (h, h));
+
+    ret = _mm_cvtsi128_si32 (_mm_add_epi32 (q, _mm_shuffle_epi32 (q, 0x1)));
+#elif defined (__AVXVNNI__)
+    const __m256i   bias    = _mm256_set1_epi8 (-0x80);
+    __m256i         sum     = _mm256_setzero_si256 ();
+    __m256i         offset  = _mm256_setzero_si256 ();
+
+    for (; i + 0x20 <= count; i += 0x20)
+    {
+        const __m256i x = _mm256_loadu_si256 ((const __m256i *) (a + i));
+        const __m256i y = _mm256_loadu_si256 ((const __m256i *) (b + i));
+
+        sum     = _mm256_dpbusd_avx_epi32 (sum, _mm256_xor_si256 (x, bias), y);
+        offset  = _mm256_dpbusd_avx_epi32 (offset, bias, y);
+    };
+
+    const __m256i   d = _mm256_sub_epi32 (sum, offset);
+    const __m128i   h = _mm_add_epi32 (_mm256_castsi256_si128 (d),
+                                       _mm256_extracti128_si256 (d, 0x1));
+    const __m128i   q = _mm_add_epi32 (h, _mm_unpackhi_epi64 (h, h));
+
+    ret = _mm_cvtsi128_si32 (_mm_add_epi32 (q, _mm_shuffle_epi32 (q, 0x1)));
+#elif defined (__AVX2__)
+    const __m256i   ones    = _mm256_set1_epi16 (0x1);
+    __m256i         sum     = _mm256_setzero_si256 ();
+
+    for (; i + 0x20 <= count; i += 0x20)
+    {
+        const __m256i x = _mm256_loadu_si256 ((const __m256i *) (a + i));
+        const __m256i y = _mm256_loadu_si256 ((const __m256i *) (b + i));
+        const __m256i p = _mm256_maddubs_epi16 (_mm256_abs_epi8 (x),
+                                                _mm256_sign_epi8 (y, x));
+
+        sum = _mm256_add_epi32 (sum, _mm256_madd_epi16 (p, ones));
+    };
+
+    const __m128i   h = _mm_add_epi32 (_mm256_castsi256_si128 (sum),
+                                       _mm256_extracti128_si256 (sum, 0x1));
+    const __m128i   q = _mm_add_epi32 (h, _mm_unpackhi_epi64 (h, h));
+
+    ret = _mm_cvtsi128_si32 (_mm_add_epi32 (q, _mm_shuffle_epi32 (q, 0x1)));
+#endif  // ! __AVX512VNNI__ || __AVXVNNI__ || __AVX2__
+
+    for (; i < count; i++)
+        ret += int32_t (a[i]) * int32_t (b[i]);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   The inner products of all rows of two matrices.
+ * \param   a       The rows of the first matrix.
+ * \param   rows_a  The number of rows of the first matrix.
+ * \param   b       The rows of the second matrix.
+ * \param   rows_b  The number of rows of the second matrix.
+ * \param   count   The number of components per row.
+ * \param   out     The buffer to write the `rows_a * rows_b` results to.
+ *
+ * This is the double precision version of the kernel below.  It shares the
+ * tiling but computes one inner product at a time.
+ */
+
+void kernel_inner_matrix (const double *    a,
+                          const dimension_t rows_a,
+                          const double *    b,
+                          const dimension_t rows_b,
+                          const dimension_t count,
+                          double *          out) noexcept
+{
+    const dimension_t width = max (count, dimension_t (0x1)) * 0x2;
+    const dimension_t tile  = max (kernel_tile / width, dimension_t (0x1));
+
+    for (dimension_t t = 0x0; t < rows_b; t += tile)
+    {
+        const dimension_t end = min (rows_b, t + tile);
+
+        for (dimension_t i = 0x0; i < rows_a; i++)
+            for (dimension_t j = t; j < end; j++)
+                out[i * rows_b + j] = kernel_inner (a + i * count,
+                                                    b + j * count, count);
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   The inner products of four rows with two other rows.
+ * \param   a       The first of four consecutive rows.
+ * \param   b       The first of two consecutive rows.
+ * \param   count   The number of components per row.
+ * \param   out     The first of the eight results.
+ * \param   stride  The distance of two results of the same column.
+ *
+ * This is the register tile of the matrix kernel below.  Every component of `a`
+ * which is loaded is used for two products, every one of `b` for four.
+ */
+
+static inline void kernel_inner_tile (const float *     a,
+                                      const float *     b,
+                                      const dimension_t count,
+                                      float *           out,
+                                      const dimension_t stride) noexcept
+{
+    float       ret [0x8]   = {0x0};
+    dimension_t i           = 0x0;
+
+#if defined (__AVX__)
+    __m256 s [0x8];
+
+    for (dimension_t k = 0x0; k < 0x8; k++)
+        s[k] = _mm256_setzero_ps ();
+
+    for (; i + 0x8 <= count; i += 0x8)
+    {
+        const __m256 y0 = _mm256_loadu_ps (b + i);
+        const __m256 y1 = _mm256_loadu_ps (b + count + i);
+
+        for (dimension_t r = 0x0; r < 0x4; r++)
+        {
+            const __m256 x = _mm256_loadu_ps (a + r * count + i);
+
+            s[0x2 * r]          = kernel_fmadd (x, y0, s[0x2 * r]);
+            s[0x2 * r + 0x1]    = kernel_fmadd (x, y1, s[0x2 * r + 0x1]);
+        };
+    };
+
+    for (dimension_t k = 0x0; k < 0x8; k++)
+        ret[k] = kernel_sum (s[k]);
+#elif defined (__SSE2__)
+    __m128 s [0x8];
+
+    for (dimension_t k = 0x0; k < 0x8; k++)
+        s[k] = _mm_setzero_ps ();
+
+    for (; i + 0x4 <= count; i += 0x4)
+    {
+        const __m128 y0 = _mm_loadu_ps (b + i);
+        const __m128 y1 = _mm_loadu_ps (b + count + i);
+
+        for (dimension_t r = 0x0; r < 0x4; r++)
+        {
+            const __m128 x = _mm_loadu_ps (a + r * count + i);
+
+            s[0x2 * r]          = _mm_add_ps (s[0x2 * r], _mm_mul_ps (x, y0));
+            s[0x2 * r + 0x1]    = _mm_add_ps (s[0x2 * r + 0x1],
+                                              _mm_mul_ps (x, y1));
+        };
+    };
+
+    for (dimension_t k = 0x0; k < 0x8; k++)
+        ret[k] = kernel_sum (s[k]);
+#endif  // ! __AVX__ || __SSE2__
+
+    for (; i < count; i++)
+        for (dimension_t r = 0x0; r < 0x4; r++)
+        {
+            ret[0x2 * r]        += a[r * count + i] * b[i];
+            ret[0x2 * r + 0x1]  += a[r * count + i] * b[count + i];
+        };
+
+    for (dimension_t r = 0x0; r < 0x4; r++)
+    {
+        out[r * stride]         = ret[0x2 * r];
+        out[r * stride + 0x1]   = ret[0x2 * r + 0x1];
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   The inner products of all rows of two matrices.
+ * \param   a       The rows of the first matrix.
+ * \param   rows_a  The number of rows of the first matrix.
+ * \param   b       The rows of the second matrix.
+ * \param   rows_b  The number of rows of the second matrix.
+ * \param   count   The number of components per row.
+ * \param   out     The buffer to write the `rows_a * rows_b` results to.
+ *
+ * This kernel computes the matrix product of `a` and the transposed `b` like a
+ * GEMM does, writing the inner product of row `i` of `a` and row `j` of `b` to
+ * `out[i * rows_b + j]`.  The rows of `b` are processed in tiles which fit
+ * into the cache while all rows of `a` are swept across them, four rows of `a`
+ * and two rows of `b` at once.
+ */
+
+void kernel_inner_matrix (const float *     a,
+                          const dimension_t rows_a,
+                          const float *     b,
+                          const dimension_t rows_b,
+                          const dimension_t count,
+                          float *           out) noexcept
+{
+    const dimension_t tile = max (kernel_tile / max (count, dimension_t (0x1)),
+                                  dimension_t (0x2));
+
+    for (dimension_t t = 0x0; t < rows_b; t += tile)
+    {
+        const dimension_t   end = min (rows_b, t + tile);
+        dimension_t         i   = 0x0;
+
+        for (; i + 0x4 <= rows_a; i += 0x4)
+        {
+            const float *   x = a + i * count;
+            float *         y = out + i * rows_b;
+            dimension_t     j = t;
+
+            for (; j + 0x2 <= end; j += 0x2)
+                kernel_inner_tile (x, b + j * count, count, y + j, rows_b);
+
+            for (; j < end; j++)
+                for (dimension_t r = 0x0; r < 0x4; r++)
+                    y[r * rows_b + j] = kernel_inner (x + r * count,
+                                                      b + j * count, count);
+        };
+
+        for (; i < rows_a; i++)
+            for (dimension_t j = t; j < end; j++)
+                out[i * rows_b + j] = kernel_inner (a + i * count,
+                                                    b + j * count, count);
+    };
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The NUMA placement kernels.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernel_numa.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the kernels which place memory and threads on the nodes
+ * of a NUMA machine.  The topology is read from sysfs and the placement is
+ * requested by system calls directly such that no further library is required.
+ * On other systems than Linux, there is a single node and nothing is placed.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <fstream>
+#include <string>
+
+// Linux system calls.
+#if defined (__linux__)
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // ! __linux__
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: ifstream;
+using std :: string;
+using std :: to_string;
+
+
+
+/**
+ * \brief   Parse a list of ranges as written by sysfs.
+ * \param   path    The file to read.
+ * \return  The listed numbers in ascending order.
+ *
+ * The file holds a comma separated list of numbers and ranges like `0-3,8`.
+ * An unreadable file yields an empty list.
+ */
+
+static vector <dimension_t> numa_list (const string & path)
+{
+    ifstream                stream  (path.c_str ());
+    vector <dimension_t>    ret;
+    string                  line;
+
+    if (! getline (stream, line))
+        return ret;
+
+    for (dimension_t i = 0x0; i < line.size ();)
+    {
+        dimension_t first = 0x0;
+
+        if (line[i] < '0' || line[i] > '9')
+            return vector <dimension_t> ();
+
+        for (; i < line.size () && line[i] >= '0' && line[i] <= '9'; i++)
+            first = first * 0xa + dimension_t (line[i] - '0');
+
+        dimension_t last = first;
+
+        if (i < line.size () && line[i] == '-')
+            for (last = 0x0, i++;
+                 i < line.size () && line[i] >= '0' && line[i] <= '9'; i++)
+                last = last * 0xa + dimension_t (line[i] - '0');
+
+        for (dimension_t n = first; n <= last; n++)
+            ret.push_back (n);
+
+        i += i < line.size () && line[i] == ',';
+    };
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   The NUMA nodes of this machine.
+ * \return  The identifiers of the online nodes.
+ *
+ * The topology is read once.  A machine without NUMA support has the node 0.
+ */
+
+static const vector <dimension_t> & numa_nodes (void)
+{
+    static const vector <dimension_t> listed
+        = numa_list ("/sys/devices/system/node/online");
+    static const vector <dimension_t> ret
+        = listed.empty () ? vector <dimension_t> (0x1, 0x0) : listed;
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Read the processors of each NUMA node.
+ * \return  The processors, indexed by the node identifiers.
+ *
+ * The list of a node is empty in case its processors are unknown.
+ */
+
+static vector <vector <dimension_t> > numa_topology (void)
+{
+    const vector <dimension_t> &    nodes   = numa_nodes ();
+    vector <vector <dimension_t> >  ret     (nodes.back () + 0x1);
+
+    for (dimension_t i = 0x0; i < nodes.size (); i++)
+        ret[nodes[i]] = numa_list ("/sys/devices/system/node/node"
+                                   + to_string (nodes[i]) + "/cpulist");
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   The processors of each NUMA node.
+ * \return  The processors, indexed by the node identifiers.
+ *
+ * The topology is read once.
+ */
+
+static const vector <vector <dimension_t> > & numa_cpus (void)
+{
+    static const vector <vector <dimension_t> > ret = numa_topology ();
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Move memory to a NUMA node.
+ * \param   data    The first byte to move.
+ * \param   bytes   The number of bytes to move.
+ * \param   node    The node to move the memory to.
+ * \return  Whether the memory has been moved.
+ *
+ * This kernel moves the complete pages within the given range to the node.
+ * The node is only preferred, such that pages which it cannot take stay on
+ * their current nodes.  Pages shared with the adjacent memory stay where they
+ * are.  A range without a complete page is moved trivially.  On a machine with
+ * a single node, nothing is moved and no system call is made, such that
+ * restricted processes do not fail.
+ *
+ * A memory policy belongs to the virtual address range rather than to the
+ * memory which currently occupies it, and would be inherited by the heap
+ * memory allocated there after this memory has been freed.  Hence, the range
+ * is reset to the default policy as soon as the pages have been moved.  Pages
+ * allocated later, including those of the range swapped back in, are placed by
+ * first touch.
+ */
+
+bool kernel_numa_bind (const void *         data,
+                       const dimension_t    bytes,
+                       const dimension_t    node) noexcept
+{
+#if defined (__linux__)
+    const uintptr_t     page    = uintptr_t (sysconf (_SC_PAGESIZE));
+    const uintptr_t     first   = uintptr_t (data);
+    const uintptr_t     begin   = (first + page - 0x1) & ~(page - 0x1);
+    const uintptr_t     end     = (first + bytes) & ~(page - 0x1);
+    unsigned long       mask [0x10] = {};
+    const dimension_t   width   = sizeof (* mask) * 0x8;
+
+    if (numa_nodes ().size () == 0x1)
+        return ! node;
+
+    if (node >= width * 0x10)
+        return false;
+
+    if (end <= begin)
+        return true;
+
+    mask[node / width] = 0x1ul << (node % width);
+
+    const bool ret = ! syscall (SYS_mbind, begin, end - begin, MPOL_PREFERRED,
+                                mask, width * 0x10 + 0x1, MPOL_MF_MOVE);
+
+    return ! syscall (SYS_mbind, begin, end - begin, MPOL_DEFAULT, nullptr,
+                      0x0, 0x0) && ret;
+#else
+    static_cast <void> (data);
+    static_cast <void> (bytes);
+    return ! node;
+#endif  // ! __linux__
+}
+
+
+
+/**
+ * \brief   The NUMA node of a worker.
+ * \param   worker  The index of the worker.
+ * \param   workers The number of workers.
+ * \return  The node the worker is assigned to.
+ *
+ * The workers are assigned to the nodes in contiguous groups of similar size,
+ * like `kernel_parallel_for` assigns the iterations to the workers.  Hence,
+ * neighbouring ranges of a partitioning share their node.
+ */
+
+dimension_t kernel_numa_node (const dimension_t worker,
+                              const dimension_t workers)
+{
+    const vector <dimension_t> & nodes = numa_nodes ();
+
+    return nodes[worker * nodes.size () / max (workers, dimension_t (0x1))];
+}
+
+
+
+/**
+ * \brief   Pin the calling thread to a NUMA node.
+ * \param   node    The node to run on.
+ * \return  Whether the thread has been pinned.
+ *
+ * The calling thread is allowed to run on all processors of the given node.
+ * The topology is read once such that pinning is cheap enough to be done by
+ * each worker of a parallel loop.
+ */
+
+bool kernel_numa_pin (const dimension_t node)
+{
+#if defined (__linux__)
+    const vector <vector <dimension_t> > &  nodes   = numa_cpus ();
+    cpu_set_t                               set;
+
+    if (node >= nodes.size () || nodes[node].empty ())
+        return ! node;
+
+    CPU_ZERO (& set);
+
+    for (dimension_t i = 0x0; i < nodes[node].size (); i++)
+        if (nodes[node][i] < CPU_SETSIZE)
+            CPU_SET (nodes[node][i], & set);
+
+    return ! sched_setaffinity (0x0, sizeof (set), & set);
+#else
+    return ! node;
+#endif  // ! __linux__
+}
+
+/******************************************************************************/
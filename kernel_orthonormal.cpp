@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The orthonormalisation kernels.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernel_orthonormal.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the kernels which orthonormalise sets of vectors.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: fill;
+using std :: numeric_limits;
+
+
+
+/*
+ * Internal helpers.
+ */
+
+/**
+ * \brief   Orthonormalise rows by the block modified Gram-Schmidt process.
+ * \param   rows        The rows to orthonormalise in place.
+ * \param   count       The number of rows.
+ * \param   dimension   The number of components per row.
+ * \return  The number of linearly independent rows.
+ *
+ * The rows are processed in panels.  A panel is first projected onto the
+ * orthogonal complement of all finished rows at once, using the matrix kernel
+ * for the coefficients; this step is done twice in order to keep the loss of
+ * orthogonality at the level of the modified process.  Then, the rows of the
+ * panel are orthonormalised one after another.  A row which loses all but a
+ * negligible part of its original norm depends on the previous ones and is
+ * set to zero.
+ */
+
+template <typename T>
+static dimension_t kernel_orthonormalise_rows (T *                 rows,
+                                               const dimension_t   count,
+                                               const dimension_t   dimension)
+{
+    const T         epsilon = numeric_limits <T> :: epsilon () * T (dimension);
+    vector <T>      norms   = vector <T> (count);
+    vector <T>      weights = vector <T> (kernel_panel * count);
+    dimension_t     ret     = 0x0;
+
+    for (dimension_t i = 0x0; i < count; i++)
+    {
+        const T * x = rows + i * dimension;
+
+        norms[i] = sqrt (kernel_inner (x, x, dimension));
+    };
+
+    for (dimension_t b = 0x0; b < count; b += kernel_panel)
+    {
+        T *                 p       = rows + b * dimension;
+        const dimension_t   size    = min (kernel_panel, count - b);
+
+        for (dimension_t pass = 0x0; b && pass < 0x2; pass++)
+        {
+            kernel_inner_matrix (p, size, rows, b, dimension, weights.data ());
+
+            for (dimension_t r = 0x0; r < size; r++)
+                for (dimension_t i = 0x0; i < b; i++)
+                    kernel_axpy (- weights[r * b + i], rows + i * dimension,
+                                 p + r * dimension, dimension);
+        };
+
+        for (dimension_t r = 0x0; r < size; r++)
+        {
+            T * x = p + r * dimension;
+
+            for (dimension_t s = 0x0; s < r; s++)
+            {
+                const T * q = p + s * dimension;
+
+                kernel_axpy (- kernel_inner (q, x, dimension), q, x, dimension);
+            };
+
+            const T norm = sqrt (kernel_inner (x, x, dimension));
+
+            if (norm > epsilon * norms[b + r])
+            {
+                kernel_scale (T (0x1) / norm, x, dimension);
+                ret++;
+            }
+            else
+                fill (x, x + dimension, T (0x0));
+        };
+    };
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Orthonormalise rows by Householder reflections.
+ * \param   rows        The rows to orthonormalise in place.
+ * \param   count       The number of rows, at most `dimension`.
+ * \param   dimension   The number of components per row.
+ * \param   r           The buffer to write the `count * count` factor to.
+ *
+ * The rows are regarded as the columns of a matrix `A` which is factorised
+ * into `Q R` like LAPACK's `geqrf` and `orgqr` do.  The reflection vectors are
+ * stored in the rows themselves before `Q` is accumulated in place, from the
+ * last reflection to the first one.  Finally, the signs are chosen such that
+ * the diagonal of `R` is non-negative; hence, the rows of `Q` match the ones of
+ * the Gram-Schmidt process for linearly independent rows.
+ */
+
+template <typename T>
+static void kernel_householder_rows (T *                 rows,
+                                     const dimension_t   count,
+                                     const dimension_t   dimension,
+                                     T *                 r)
+{
+    vector <T> taus = vector <T> (count);
+
+    for (dimension_t k = 0x0; k < count; k++)
+    {
+        T *                 x       = rows + k * dimension + k;
+        const dimension_t   length  = dimension - k - 0x1;
+        const T             sigma   = kernel_inner (x + 0x1, x + 0x1, length);
+
+        if (sigma == T (0x0))
+            continue;
+
+        const T norm = sqrt (x[0x0] * x[0x0] + sigma);
+        const T beta = x[0x0] > T (0x0) ? - norm : norm;
+
+        taus[k] = (beta - x[0x0]) / beta;
+        kernel_scale (T (0x1) / (x[0x0] - beta), x + 0x1, length);
+        x[0x0] = beta;
+
+        for (dimension_t j = k + 0x1; j < count; j++)
+        {
+            T *     y = rows + j * dimension + k;
+            const T w = taus[k] * (y[0x0] + kernel_inner (x + 0x1, y + 0x1,
+                                                          length));
+
+            y[0x0] -= w;
+            kernel_axpy (- w, x + 0x1, y + 0x1, length);
+        };
+    };
+
+    for (dimension_t i = 0x0; i < count; i++)
+        for (dimension_t j = 0x0; j < count; j++)
+            r[i * count + j] = i <= j ? rows[j * dimension + i] : T (0x0);
+
+    for (dimension_t k = count; k--; )
+    {
+        T *                 x       = rows + k * dimension + k;
+        const dimension_t   length  = dimension - k - 0x1;
+
+        for (dimension_t j = k + 0x1; taus[k] != T (0x0) && j < count; j++)
+        {
+            T *     y = rows + j * dimension + k;
+            const T w = taus[k] * (y[0x0] + kernel_inner (x + 0x1, y + 0x1,
+                                                          length));
+
+            y[0x0] -= w;
+            kernel_axpy (- w, x + 0x1, y + 0x1, length);
+        };
+
+        kernel_scale (- taus[k], x + 0x1, length);
+        x[0x0] = T (0x1) - taus[k];
+        fill (rows + k * dimension, x, T (0x0));
+    };
+
+    for (dimension_t k = 0x0; k < count; k++)
+        if (r[k * count + k] < T (0x0))
+        {
+            kernel_scale (T (- 0x1), rows + k * dimension, dimension);
+            kernel_scale (T (- 0x1), r + k * count + k, count - k);
+        };
+
+    return;
+}
+
+
+
+/*
+ * Kernels.
+ */
+
+/**
+ * \brief   Factorise rows into orthonormal rows and a triangular factor.
+ * \param   rows        The rows to orthonormalise in place.
+ * \param   count       The number of rows, at most `dimension`.
+ * \param   dimension   The number of components per row.
+ * \param   r           The buffer to write the `count * count` factor to.
+ *
+ * This is the double precision version of the kernel below.
+ */
+
+void kernel_householder (double *           rows,
+                         const dimension_t  count,
+                         const dimension_t  dimension,
+                         double *           r)
+{
+    kernel_householder_rows (rows, count, dimension, r);
+    return;
+}
+
+
+
+/**
+ * \brief   Factorise rows into orthonormal rows and a triangular factor.
+ * \param   rows        The rows to orthonormalise in place.
+ * \param   count       The number of rows, at most `dimension`.
+ * \param   dimension   The number of components per row.
+ * \param   r           The buffer to write the `count * count` factor to.
+ *
+ * After this kernel, row `j` of the input equals the sum of `r[i * count + j]`
+ * times the output row `i` over all `i <= j`.
+ */
+
+void kernel_householder (float *            rows,
+                         const dimension_t  count,
+                         const dimension_t  dimension,
+                         float *            r)
+{
+    kernel_householder_rows (rows, count, dimension, r);
+    return;
+}
+
+
+
+/**
+ * \brief   Orthonormalise rows by the modified Gram-Schmidt process.
+ * \param   rows        The rows to orthonormalise in place.
+ * \param   count       The number of rows.
+ * \param   dimension   The number of components per row.
+ * \return  The number of linearly independent rows.
+ *
+ * This is the double precision version of the kernel below.
+ */
+
+dimension_t kernel_orthonormalise (double *             rows,
+                                   const dimension_t    count,
+                                   const dimension_t    dimension)
+{
+    return kernel_orthonormalise_rows (rows, count, dimension);
+}
+
+
+
+/**
+ * \brief   Orthonormalise rows by the modified Gram-Schmidt process.
+ * \param   rows        The rows to orthonormalise in place.
+ * \param   count       The number of rows.
+ * \param   dimension   The number of components per row.
+ * \return  The number of linearly independent rows.
+ *
+ * Rows which depend linearly on the previous ones are set to zero.
+ */
+
+dimension_t kernel_orthonormalise (float *              rows,
+                                   const dimension_t    count,
+                                   const dimension_t    dimension)
+{
+    return kernel_orthonormalise_rows (rows, count, dimension);
+}
+
+/******************************************************************************/
@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The sparse vector kernels.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernel_sparse.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the kernels for sparse vectors.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: lower_bound;
+
+
+
+/**
+ * \brief   The squared distance of a sparse and a dense vector.
+ * \param   indices     The sorted indices of the sparse vector.
+ * \param   values      The values of the sparse vector.
+ * \param   count       The number of non-zero components of the sparse vector.
+ * \param   dense       The components of the dense vector.
+ * \param   dimension   The dimension of both vectors.
+ * \return  The squared Euclidean distance.
+ *
+ * The squared norm of the dense vector is computed by the dense kernel and
+ * corrected by `v * (v - 2 * y)` at each non-zero component `v`, which turns
+ * the term `y * y` into `(y - v) * (y - v)`.
+ */
+
+float kernel_sparse_distance (const uint32_t *  indices,
+                              const float *     values,
+                              const dimension_t count,
+                              const float *     dense,
+                              const dimension_t dimension) noexcept
+{
+    float ret = kernel_inner (dense, dense, dimension);
+
+    for (dimension_t k = 0x0; k < count; k++)
+        ret += values[k] * (values[k] - 2.0f * dense[indices[k]]);
+
+    return max (ret, 0.0f);
+}
+
+
+
+/**
+ * \brief   The squared distance of two sparse vectors.
+ * \param   ia  The sorted indices of the first vector.
+ * \param   a   The values of the first vector.
+ * \param   na  The number of non-zero components of the first vector.
+ * \param   ib  The sorted indices of the second vector.
+ * \param   b   The values of the second vector.
+ * \param   nb  The number of non-zero components of the second vector.
+ * \return  The squared Euclidean distance.
+ *
+ * Both lists are walked side by side; a component present in only one of them
+ * contributes its square.  The pointers advance without branches.  If one list
+ * is much longer, the indices of the shorter one are searched for instead and
+ * the skipped ranges of the longer one contribute the squared norm computed by
+ * the dense kernel.
+ */
+
+float kernel_sparse_distance (const uint32_t *  ia,
+                              const float *     a,
+                              const dimension_t na,
+                              const uint32_t *  ib,
+                              const float *     b,
+                              const dimension_t nb) noexcept
+{
+    if (na > nb)
+        return kernel_sparse_distance (ib, b, nb, ia, a, na);
+
+    dimension_t i   = 0x0;
+    dimension_t j   = 0x0;
+    float       ret = 0x0;
+
+    if (na * kernel_gallop < nb)
+    {
+        for (; i < na; i++)
+        {
+            const dimension_t k = dimension_t (lower_bound (ib + j, ib + nb,
+                                                            ia[i]) - ib);
+
+            ret += kernel_inner (b + j, b + j, k - j);
+
+            if (k < nb && ib[k] == ia[i])
+            {
+                ret += (a[i] - b[k]) * (a[i] - b[k]);
+                j   = k + 0x1;
+            }
+            else
+            {
+                ret += a[i] * a[i];
+                j   = k;
+            };
+        };
+
+        return ret + kernel_inner (b + j, b + j, nb - j);
+    };
+
+    while (i < na && j < nb)
+    {
+        const uint32_t  x = ia[i];
+        const uint32_t  y = ib[j];
+        const float     d = (x <= y ? a[i] : 0.0f) - (y <= x ? b[j] : 0.0f);
+
+        ret += d * d;
+        i   += x <= y;
+        j   += y <= x;
+    };
+
+    return ret + kernel_inner (a + i, a + i, na - i)
+               + kernel_inner (b + j, b + j, nb - j);
+}
+
+
+
+/**
+ * \brief   The inner product of a sparse and a dense vector.
+ * \param   indices The sorted indices of the sparse vector.
+ * \param   values  The values of the sparse vector.
+ * \param   count   The number of non-zero components of the sparse vector.
+ * \param   dense   The components of the dense vector.
+ * \return  The inner product.
+ *
+ * This kernel gathers the components of the dense vector at the non-zero
+ * positions.  Four independent sums hide the latency of the additions.
+ */
+
+float kernel_sparse_inner (const uint32_t *     indices,
+                           const float *        values,
+                           const dimension_t    count,
+                           const float *        dense) noexcept
+{
+    dimension_t k   = 0x0;
+    float       s0  = 0x0;
+    float       s1  = 0x0;
+    float       s2  = 0x0;
+    float       s3  = 0x0;
+
+    for (; k + 0x4 <= count; k += 0x4)
+    {
+        s0 += values[k]         * dense[indices[k]];
+        s1 += values[k + 0x1]   * dense[indices[k + 0x1]];
+        s2 += values[k + 0x2]   * dense[indices[k + 0x2]];
+        s3 += values[k + 0x3]   * dense[indices[k + 0x3]];
+    };
+
+    for (; k < count; k++)
+        s0 += values[k] * dense[indices[k]];
+
+    return (s0 + s1) + (s2 + s3);
+}
+
+
+
+/**
+ * \brief   The inner product of two sparse vectors.
+ * \param   ia  The sorted indices of the first vector.
+ * \param   a   The values of the first vector.
+ * \param   na  The number of non-zero components of the first vector.
+ * \param   ib  The sorted indices of the second vector.
+ * \param   b   The values of the second vector.
+ * \param   nb  The number of non-zero components of the second vector.
+ * \return  The inner product.
+ *
+ * Only the common indices contribute.  Both lists are walked side by side
+ * without branches unless one of them is much longer; then, the indices of the
+ * shorter one are searched for in the remainder of the longer one.
+ */
+
+float kernel_sparse_inner (const uint32_t *     ia,
+                           const float *        a,
+                           const dimension_t    na,
+                           const uint32_t *     ib,
+                           const float *        b,
+                           const dimension_t    nb) noexcept
+{
+    if (na > nb)
+        return kernel_sparse_inner (ib, b, nb, ia, a, na);
+
+    dimension_t i   = 0x0;
+    dimension_t j   = 0x0;
+    float       ret = 0x0;
+
+    if (na * kernel_gallop < nb)
+    {
+        for (; i < na && j < nb; i++)
+        {
+            j = dimension_t (lower_bound (ib + j, ib + nb, ia[i]) - ib);
+
+            if (j < nb && ib[j] == ia[i])
+                ret += a[i] * b[j++];
+        };
+
+        return ret;
+    };
+
+    while (i < na && j < nb)
+    {
+        const uint32_t x = ia[i];
+        const uint32_t y = ib[j];
+
+        ret += x == y ? a[i] * b[j] : 0.0f;
+        i   += x <= y;
+        j   += y <= x;
+    };
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Add a multiple of a sparse vector to a dense one.
+ * \param   alpha   The factor of the sparse vector.
+ * \param   indices The sorted indices of the sparse vector.
+ * \param   values  The values of the sparse vector.
+ * \param   count   The number of non-zero components of the sparse vector.
+ * \param   dense   The components of the dense vector to update.
+ *
+ * This kernel computes `dense += alpha * sparse` by touching the non-zero
+ * positions only.
+ */
+
+void kernel_sparse_scatter (const float         alpha,
+                            const uint32_t *    indices,
+                            const float *       values,
+                            const dimension_t   count,
+                            float *             dense) noexcept
+{
+    for (dimension_t k = 0x0; k < count; k++)
+        dense[indices[k]] += alpha * values[k];
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The concurrent vector store kernels.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernel_store.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the storage of the concurrent vector store.  All threads
+ * operate on it without locks.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: copy;
+
+
+
+/**
+ * \brief   Get a segment and allocate it in case it is missing.
+ * \param   segment The directory entry of the segment.
+ * \param   size    The number of elements of the segment.
+ * \return  The segment.
+ *
+ * Several threads may need a missing segment at the same time.  Each of them
+ * allocates it but only the first one installs its allocation; the others free
+ * theirs and continue with the installed one.  The elements are initialised to
+ * zero.
+ */
+
+template <typename U>
+static U * store_segment (atomic <U *> &       segment,
+                          const dimension_t    size)
+{
+    U * ret = segment.load ();
+
+    if (ret)
+        return ret;
+
+    U * allocation = new U [size] ();
+
+    if (segment.compare_exchange_strong (ret, allocation))
+        return allocation;
+
+    delete [] allocation;
+    return ret;
+}
+
+
+
+/**
+ * \brief   Advance a published number over all complete entries.
+ * \param   published   The number of published entries.
+ * \param   complete    Whether a certain entry is complete.
+ *
+ * Any thread completing an entry calls this function afterwards.  Since the
+ * entries are completed and checked with sequentially consistent operations,
+ * the last thread to complete an entry of a contiguous range publishes the
+ * whole range.
+ */
+
+template <typename F>
+static void store_publish (atomic <dimension_t> &   published,
+                           const F &                complete)
+{
+    dimension_t p = published.load ();
+
+    while (complete (p))
+        if (published.compare_exchange_weak (p, p + 0x1))
+            p++;
+
+    return;
+}
+
+
+
+/**
+ * \brief   Create an empty store.
+ * \param   chunk       The number of rows of the first segment.
+ * \param   dimension   The dimension of the rows.
+ */
+
+kernel_store :: kernel_store (const dimension_t chunk,
+                              const dimension_t dimension) noexcept
+    : appended  (0x0)
+    , chunk     (chunk)
+    , dimension (dimension)
+    , erasures  (0x0)
+    , logged    (0x0)
+    , reserved  (0x0)
+{
+    for (dimension_t s = 0x0; s < kernel_segments; s++)
+    {
+        this -> log[s].store (nullptr);
+        this -> rows[s].store (nullptr);
+        this -> states[s].store (nullptr);
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Free all segments.
+ *
+ * No thread may access the store any longer.
+ */
+
+kernel_store :: ~kernel_store (void)
+{
+    for (dimension_t s = 0x0; s < kernel_segments; s++)
+    {
+        delete [] this -> log[s].load ();
+        delete [] this -> rows[s].load ();
+        delete [] this -> states[s].load ();
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Append a row.
+ * \param   row The components of the row.
+ * \return  The index of the row.
+ *
+ * The row is reserved by a single atomic increment, written to its segment and
+ * published once all preceding rows are complete.
+ */
+
+dimension_t kernel_store :: append (const float * row)
+{
+    const dimension_t   ret     = this -> reserved.fetch_add (0x1);
+    dimension_t         offset  = 0x0;
+    const dimension_t   s       = this -> segment (ret, offset);
+    const dimension_t   size    = this -> chunk << s;
+    float *             rows    = store_segment (this -> rows[s],
+                                                 size * this -> dimension);
+    atomic <uint64_t> * states  = store_segment (this -> states[s], size);
+
+    copy (row, row + this -> dimension, rows + offset * this -> dimension);
+    states[offset].store (0x1);
+    store_publish (this -> appended, [&] (const dimension_t index)
+    {
+        return this -> state (index) != 0x0;
+    });
+    return ret;
+}
+
+
+
+/**
+ * \brief   Erase a row.
+ * \param   index   The index of the row.
+ * \return  Whether this call erased the row.
+ *
+ * The erasure reserves the next position of the log and tags the row with it.
+ * The position is logged even if the row is unpublished or erased already such
+ * that the publication of the subsequent erasures is not held up.
+ */
+
+bool kernel_store :: erase (const dimension_t index)
+{
+    const dimension_t   position    = this -> logged.fetch_add (0x1);
+    dimension_t         offset      = 0x0;
+    const dimension_t   s           = this -> segment (position, offset);
+    atomic <uint8_t> *  log         = store_segment (this -> log[s],
+                                                     this -> chunk << s);
+    dimension_t         row         = 0x0;
+    uint64_t            expected    = 0x1;
+    bool                ret         = false;
+
+    if (index < this -> appended.load ())
+        ret = this -> states[this -> segment (index, row)].load ()[row]
+                  .compare_exchange_strong (expected, position + 0x2);
+
+    log[offset].store (0x1);
+    store_publish (this -> erasures, [&] (const dimension_t entry)
+    {
+        dimension_t                 at      = 0x0;
+        const atomic <uint8_t> *    entries
+            = this -> log[this -> segment (entry, at)].load ();
+
+        return entries && entries[at].load ();
+    });
+    return ret;
+}
+
+
+
+/**
+ * \brief   The components of a row.
+ * \param   index   The index of the row.
+ * \return  The first component of the row.
+ *
+ * The row needs to be published.
+ */
+
+const float * kernel_store :: row (const dimension_t index) const noexcept
+{
+    dimension_t         offset  = 0x0;
+    const dimension_t   s       = this -> segment (index, offset);
+
+    return this -> rows[s].load () + offset * this -> dimension;
+}
+
+
+
+/**
+ * \brief   Locate a row in the segments.
+ * \param   index   The index of the row.
+ * \param   offset  The index of the row within its segment.
+ * \return  The segment of the row.
+ *
+ * The segment `s` starts at the row `chunk * (2^s - 1)`.
+ */
+
+dimension_t kernel_store :: segment (const dimension_t  index,
+                                     dimension_t &      offset) const noexcept
+{
+    const dimension_t   quotient    = index / this -> chunk + 0x1;
+    dimension_t         ret         = 0x0;
+
+    while (quotient >> (ret + 0x1))
+        ret++;
+
+    offset = index - this -> chunk * ((dimension_t (0x1) << ret) - 0x1);
+    return ret;
+}
+
+
+
+/**
+ * \brief   The state of a row.
+ * \param   index   The index of the row.
+ * \return  The state of the row; zero if its segment is missing.
+ */
+
+uint64_t kernel_store :: state (const dimension_t index) const noexcept
+{
+    dimension_t                 offset  = 0x0;
+    const atomic <uint64_t> *   states
+        = this -> states[this -> segment (index, offset)].load ();
+
+    return states ? states[offset].load () : 0x0;
+}
+
+/******************************************************************************/
@@ -0,0 +1,1219 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The internal computational kernels of this library.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kernels.hpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file introduces the kernels the vector classes are built upon.  The
+ * kernels operate on raw memory and do not check their arguments; they are no
+ * part of the public interface.
+ */
+
+/******************************************************************************/
+
+/**
+ * \brief   Prevent this header from being included twice.
+ *
+ * In case this header file should be included more than just once, unexpected
+ * side effects might take place.  This unintended behaviour will be avoided by
+ * the definition of this macro.
+ */
+
+#pragma once
+#ifndef __KERNELS_HPP__
+#define __KERNELS_HPP__
+
+
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: atomic;
+using std :: chrono :: duration_cast;
+using std :: chrono :: nanoseconds;
+using std :: chrono :: steady_clock;
+using std :: cos;
+using std :: log;
+using std :: max;
+using std :: memory_order_relaxed;
+using std :: min;
+
+
+
+/**
+ * \brief   The number of components to convert at once.
+ *
+ * Mixed-precision kernels convert their operands block by block into buffers
+ * on the stack.  This constant is the length of such a block.
+ */
+
+const dimension_t kernel_block = 0x100;
+
+
+
+/**
+ * \brief   The ratio of lengths from which sparse vectors are merged by search.
+ *
+ * If one list of indices is at least this many times longer than the other,
+ * the shorter one looks its indices up in the longer one by binary search
+ * instead of walking both lists side by side.
+ */
+
+const dimension_t kernel_gallop = 0x10;
+
+
+
+/**
+ * \brief   The number of 64 bit lanes of the content hash.
+ */
+
+const dimension_t kernel_hash_lanes = 0x4;
+
+
+
+/**
+ * \brief   The number of bytes the content hash consumes at once.
+ *
+ * A block of `kernel_block` components of any scalar type consists of complete
+ * stripes.
+ */
+
+const dimension_t kernel_hash_stripe = 0x20;
+
+
+
+/**
+ * \brief   The number of rows to process at once by the assignment to clusters.
+ *
+ * The inner products of such a panel of rows with all centroids are buffered
+ * before the nearest centroid of each row is determined.
+ */
+
+const dimension_t kernel_panel = 0x40;
+
+
+
+/**
+ * \brief   The maximal number of segments of a concurrent vector store.
+ *
+ * Each segment is twice as large as its predecessor, such that this many
+ * segments hold far more rows than the memory of any machine.
+ */
+
+const dimension_t kernel_segments = 0x30;
+
+
+
+/**
+ * \brief   The number of components of the second operand to keep cached.
+ *
+ * The inner product of two matrices processes the rows of the second operand
+ * in tiles of about this many components, such that a tile fits into the L2
+ * cache while all rows of the first operand are swept across it.
+ */
+
+const dimension_t kernel_tile = 0x8000;
+
+
+
+/**
+ * \brief   The element-wise operations.
+ *
+ * The first four operations combine two operands and are performed by
+ * `kernel_binary`; the remaining ones transform a single operand and are
+ * performed by `kernel_unary`.
+ */
+
+enum kernel_op_t
+{
+    kernel_divide,
+    kernel_maximum,
+    kernel_minimum,
+    kernel_multiply,
+    kernel_absolute,
+    kernel_exponential,
+    kernel_square_root
+};
+
+
+
+/**
+ * \brief   The counters of the instrumentation.
+ *
+ * Each operation has four counters:  the calls, the components processed, the
+ * bytes allocated and the nanoseconds spent, in this order.
+ */
+
+extern atomic <uint64_t> kernel_profile [Rnpp_operations][0x4];
+
+
+
+#if defined (__RNFPP_INSTRUMENT__)
+/**
+ * \brief   The instrumentation of an operation.
+ *
+ * An object of this class counts the call of an operation, its components and
+ * its allocations when it is constructed and the time spent in the operation
+ * when it is destroyed.
+ */
+
+class kernel_profile_scope
+{
+    private:
+        const Rnpp_operation_t              operation;
+        const steady_clock :: time_point    start;
+
+    public:
+        kernel_profile_scope    (const Rnpp_operation_t operation,
+                                 const uint64_t         elements,
+                                 const uint64_t         bytes) noexcept;
+        ~kernel_profile_scope   (void) noexcept;
+};
+
+
+
+/**
+ * \brief   Start the instrumentation of an operation.
+ * \param   operation   The operation to count.
+ * \param   elements    The number of components the operation processes.
+ * \param   bytes       The number of bytes the operation allocates.
+ */
+
+inline kernel_profile_scope :: kernel_profile_scope
+    (const Rnpp_operation_t operation,
+     const uint64_t         elements,
+     const uint64_t         bytes) noexcept
+    : operation (operation)
+    , start     (steady_clock :: now ())
+{
+    kernel_profile[operation][0x0].fetch_add (0x1, memory_order_relaxed);
+    kernel_profile[operation][0x1].fetch_add (elements, memory_order_relaxed);
+    kernel_profile[operation][0x2].fetch_add (bytes, memory_order_relaxed);
+    return;
+}
+
+
+
+/**
+ * \brief   Finish the instrumentation of an operation.
+ */
+
+inline kernel_profile_scope :: ~kernel_profile_scope (void) noexcept
+{
+    kernel_profile[this -> operation][0x3].fetch_add
+        (uint64_t (duration_cast <nanoseconds> (steady_clock :: now ()
+                                                - this -> start).count ()),
+         memory_order_relaxed);
+    return;
+}
+#endif  // ! __RNFPP_INSTRUMENT__
+
+
+
+/**
+ * \brief   Instrument the enclosing operation.
+ * \param   operation   The operation to count.
+ * \param   elements    The number of components the operation processes.
+ * \param   bytes       The number of bytes the operation allocates.
+ *
+ * Unless `__RNFPP_INSTRUMENT__` is defined, this macro expands to nothing and
+ * its arguments are not evaluated.
+ */
+
+#if defined (__RNFPP_INSTRUMENT__)
+#define KERNEL_PROFILE(operation, elements, bytes)                             \
+    const kernel_profile_scope kernel_scope (operation, elements, bytes)
+#else
+#define KERNEL_PROFILE(operation, elements, bytes)
+#endif  // ! __RNFPP_INSTRUMENT__
+
+
+
+/**
+ * \brief   The storage of a concurrent vector store.
+ *
+ * The rows are appended to segments of `chunk << s` rows for the segment `s`.
+ * A segment is allocated by the first thread which needs it and never moved,
+ * such that readers do not need to synchronise with the writers beyond the
+ * number of rows.  Each row has a state:  zero while the row is being written,
+ * one as soon as it is complete and `2 + p` after its erasure was logged at the
+ * position `p`.  The log of erasures is segmented the same way.
+ *
+ * The numbers of rows and of erasures are published in order:  each thread
+ * completing an entry advances the published number over all complete entries
+ * in a row.  A stalled writer delays the publication of the subsequent entries
+ * but never blocks another thread.  A segment which cannot be allocated leaves
+ * its reserved rows unpublished.
+ */
+
+class kernel_store
+{
+    public:
+        atomic <dimension_t>            appended;
+        const dimension_t               chunk;
+        const dimension_t               dimension;
+        atomic <dimension_t>            erasures;
+        atomic <atomic <uint8_t> *>     log         [kernel_segments];
+        atomic <dimension_t>            logged;
+        atomic <dimension_t>            reserved;
+        atomic <float *>                rows        [kernel_segments];
+        atomic <atomic <uint64_t> *>    states      [kernel_segments];
+
+        kernel_store    (const dimension_t  chunk,
+                         const dimension_t  dimension) noexcept;
+
+        ~kernel_store   (void);
+
+        dimension_t     append  (const float *          row);
+        bool            erase   (const dimension_t      index);
+        const float *   row     (const dimension_t      index)  const noexcept;
+        dimension_t     segment (const dimension_t      index,
+                                 dimension_t &          offset) const noexcept;
+        uint64_t        state   (const dimension_t      index)  const noexcept;
+
+        template <typename F>
+        void            scan    (const dimension_t      count,
+                                 const F &              body)   const;
+};
+
+
+
+/**
+ * \brief   Scan the first rows of a store segment by segment.
+ * \param   count   The number of rows to scan.
+ * \param   body    The function to call for each segment.
+ *
+ * The function is called with the index of the first row of the segment, the
+ * number of rows to process, the components of the rows and their states.  The
+ * rows to scan need to be published.
+ */
+
+template <typename F>
+inline void kernel_store :: scan (const dimension_t  count,
+                                  const F &          body) const
+{
+    for (dimension_t s = 0x0, first = 0x0; first < count; s++)
+    {
+        const dimension_t size = this -> chunk << s;
+
+        body (first, min (size, count - first), this -> rows[s].load (),
+              this -> states[s].load ());
+        first += size;
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Check whether a row of a store is erased in a snapshot.
+ * \param   state       The state of the row.
+ * \param   erasures    The number of erasures published to the snapshot.
+ * \return  Whether the erasure of the row belongs to the snapshot.
+ *
+ * An erasure logged after the snapshot was taken does not affect the snapshot,
+ * even if the state of the row already reflects it.
+ */
+
+inline bool kernel_store_erased (const uint64_t     state,
+                                 const dimension_t  erasures) noexcept
+{
+    return state >= 0x2 && state - 0x2 < erasures;
+}
+
+
+
+/*
+ * Kernels.
+ */
+
+bool        kernel_approx_equal     (const double *     a,
+                                     const double *     b,
+                                     const dimension_t  count,
+                                     const double       absolute,
+                                     const double       relative,
+                                     const uint32_t     ulps)   noexcept;
+bool        kernel_approx_equal     (const float *      a,
+                                     const float *      b,
+                                     const dimension_t  count,
+                                     const float        absolute,
+                                     const float        relative,
+                                     const uint32_t     ulps)   noexcept;
+void        kernel_axpby            (const double       alpha,
+                                     const double *     x,
+                                     const double       beta,
+                                     double *           y,
+                                     const dimension_t  count)  noexcept;
+void        kernel_axpby            (const float        alpha,
+                                     const float *      x,
+                                     const float        beta,
+                                     float *            y,
+                                     const dimension_t  count)  noexcept;
+void        kernel_axpy             (const double       alpha,
+                                     const double *     x,
+                                     double *           y,
+                                     const dimension_t  count)  noexcept;
+void        kernel_axpy             (const float        alpha,
+                                     const float *      x,
+                                     float *            y,
+                                     const dimension_t  count)  noexcept;
+void        kernel_binary           (const kernel_op_t  op,
+                                     const double *     a,
+                                     const double *     b,
+                                     double *           out,
+                                     const dimension_t  count)  noexcept;
+void        kernel_binary           (const kernel_op_t  op,
+                                     const float *      a,
+                                     const float *      b,
+                                     float *            out,
+                                     const dimension_t  count)  noexcept;
+void        kernel_canonicalise     (const double *     in,
+                                     double *           out,
+                                     const dimension_t  count)  noexcept;
+void        kernel_canonicalise     (const float *      in,
+                                     float *            out,
+                                     const dimension_t  count)  noexcept;
+void        kernel_clamp            (const double       lower,
+                                     const double       upper,
+                                     const double *     in,
+                                     double *           out,
+                                     const dimension_t  count)  noexcept;
+void        kernel_clamp            (const float        lower,
+                                     const float        upper,
+                                     const float *      in,
+                                     float *            out,
+                                     const dimension_t  count)  noexcept;
+double      kernel_distance_squared (const double *     a,
+                                     const double *     b,
+                                     const dimension_t  count)  noexcept;
+float       kernel_distance_squared (const float *      a,
+                                     const float *      b,
+                                     const dimension_t  count)  noexcept;
+void        kernel_eigen            (double *           a,
+                                     const dimension_t  count,
+                                     double *           values,
+                                     double *           vectors) noexcept;
+bool        kernel_equal            (const double *     a,
+                                     const double *     b,
+                                     const dimension_t  count)  noexcept;
+bool        kernel_equal            (const float *      a,
+                                     const float *      b,
+                                     const dimension_t  count)  noexcept;
+uint64_t    kernel_hash             (const void *       data,
+                                     const dimension_t  bytes,
+                                     const uint64_t     seed)   noexcept;
+uint64_t    kernel_hash_final       (uint64_t *         acc,
+                                     const void *       tail,
+                                     const dimension_t  bytes,
+                                     const dimension_t  length,
+                                     const dimension_t  stripes) noexcept;
+void        kernel_hash_init        (uint64_t *         acc,
+                                     const uint64_t     seed)   noexcept;
+void        kernel_hash_update      (uint64_t *         acc,
+                                     const void *       data,
+                                     const dimension_t  count,
+                                     const dimension_t  offset) noexcept;
+void        kernel_householder      (double *           rows,
+                                     const dimension_t  count,
+                                     const dimension_t  dimension,
+                                     double *           r);
+void        kernel_householder      (float *            rows,
+                                     const dimension_t  count,
+                                     const dimension_t  dimension,
+                                     float *            r);
+double      kernel_inner            (const double *     a,
+                                     const double *     b,
+                                     const dimension_t  count)  noexcept;
+float       kernel_inner            (const float *      a,
+                                     const float *      b,
+                                     const dimension_t  count)  noexcept;
+int32_t     kernel_inner            (const int8_t *     a,
+                                     const int8_t *     b,
+                                     const dimension_t  count)  noexcept;
+void        kernel_inner_matrix     (const double *     a,
+                                     const dimension_t  rows_a,
+                                     const double *     b,
+                                     const dimension_t  rows_b,
+                                     const dimension_t  count,
+                                     double *           out)    noexcept;
+void        kernel_inner_matrix     (const float *      a,
+                                     const dimension_t  rows_a,
+                                     const float *      b,
+                                     const dimension_t  rows_b,
+                                     const dimension_t  count,
+                                     float *            out)    noexcept;
+void        kernel_narrow           (const float *      in,
+                                     bfloat16_t *       out,
+                                     const dimension_t  count)  noexcept;
+void        kernel_narrow           (const float *      in,
+                                     half_t *           out,
+                                     const dimension_t  count)  noexcept;
+bool        kernel_numa_bind        (const void *       data,
+                                     const dimension_t  bytes,
+                                     const dimension_t  node)   noexcept;
+dimension_t kernel_numa_node        (const dimension_t  worker,
+                                     const dimension_t  workers);
+bool        kernel_numa_pin         (const dimension_t  node);
+dimension_t kernel_orthonormalise   (double *           rows,
+                                     const dimension_t  count,
+                                     const dimension_t  dimension);
+dimension_t kernel_orthonormalise   (float *            rows,
+                                     const dimension_t  count,
+                                     const dimension_t  dimension);
+void        kernel_scale            (const double       alpha,
+                                     double *           x,
+                                     const dimension_t  count)  noexcept;
+void        kernel_scale            (const float        alpha,
+                                     float *            x,
+                                     const dimension_t  count)  noexcept;
+float       kernel_sparse_distance  (const uint32_t *   indices,
+                                     const float *      values,
+                                     const dimension_t  count,
+                                     const float *      dense,
+                                     const dimension_t  dimension) noexcept;
+float       kernel_sparse_distance  (const uint32_t *   ia,
+                                     const float *      a,
+                                     const dimension_t  na,
+                                     const uint32_t *   ib,
+                                     const float *      b,
+                                     const dimension_t  nb)     noexcept;
+float       kernel_sparse_inner     (const uint32_t *   indices,
+                                     const float *      values,
+                                     const dimension_t  count,
+                                     const float *      dense)  noexcept;
+float       kernel_sparse_inner     (const uint32_t *   ia,
+                                     const float *      a,
+                                     const dimension_t  na,
+                                     const uint32_t *   ib,
+                                     const float *      b,
+                                     const dimension_t  nb)     noexcept;
+void        kernel_sparse_scatter   (const float        alpha,
+                                     const uint32_t *   indices,
+                                     const float *      values,
+                                     const dimension_t  count,
+                                     float *            dense)  noexcept;
+void        kernel_unary            (const kernel_op_t  op,
+                                     const double *     in,
+                                     double *           out,
+                                     const dimension_t  count)  noexcept;
+void        kernel_unary            (const kernel_op_t  op,
+                                     const float *      in,
+                                     float *            out,
+                                     const dimension_t  count)  noexcept;
+void        kernel_widen            (const bfloat16_t * in,
+                                     float *            out,
+                                     const dimension_t  count)  noexcept;
+void        kernel_widen            (const half_t *     in,
+                                     float *            out,
+                                     const dimension_t  count)  noexcept;
+
+
+
+/**
+ * \brief   Convert components from one type into another.
+ * \param   in      The components to convert.
+ * \param   out     The buffer to write the converted components to.
+ * \param   count   The number of components.
+ *
+ * This is the generic conversion which passes each component through the
+ * scalar type of its source.  The conversions between `float` and the reduced
+ * precisions are delegated to the vectorised kernels.
+ */
+
+template <typename T, typename U>
+inline void kernel_convert (const T * in, U * out, const dimension_t count)
+    noexcept
+{
+    for (dimension_t i = 0x0; i < count; i++)
+        out[i] = U (typename Rnpp_traits <T> :: scalar_t (in[i]));
+
+    return;
+}
+
+inline void kernel_convert (const float *      in,
+                            bfloat16_t *       out,
+                            const dimension_t  count) noexcept
+{
+    kernel_narrow (in, out, count);
+    return;
+}
+
+inline void kernel_convert (const float *      in,
+                            half_t *           out,
+                            const dimension_t  count) noexcept
+{
+    kernel_narrow (in, out, count);
+    return;
+}
+
+inline void kernel_convert (const bfloat16_t * in,
+                            float *            out,
+                            const dimension_t  count) noexcept
+{
+    kernel_widen (in, out, count);
+    return;
+}
+
+inline void kernel_convert (const half_t *     in,
+                            float *            out,
+                            const dimension_t  count) noexcept
+{
+    kernel_widen (in, out, count);
+    return;
+}
+
+
+
+/**
+ * \brief   Provide a block of components as `float`.
+ * \param   in      The components to provide.
+ * \return  The components as `float`.
+ *
+ * Components which are already stored as `float` do not need to be converted
+ * and are passed through.
+ */
+
+inline const float * kernel_as_float (const float * in, float *, dimension_t)
+    noexcept
+{
+    return in;
+}
+
+
+
+/**
+ * \brief   Provide a block of components as `float`.
+ * \param   in      The components to provide.
+ * \param   buffer  The buffer to convert into.
+ * \param   count   The number of components.
+ * \return  The components as `float`.
+ *
+ * Components of a reduced precision are widened into the given buffer.
+ */
+
+template <typename T>
+inline const float * kernel_as_float (const T *         in,
+                                      float *           buffer,
+                                      const dimension_t count) noexcept
+{
+    kernel_widen (in, buffer, count);
+    return buffer;
+}
+
+
+
+/**
+ * \brief   Combine two vectors of a reduced precision linearly in place.
+ * \param   alpha   The factor of `x`.
+ * \param   x       The vector to scale.
+ * \param   beta    The factor of `y`.
+ * \param   y       The vector to update.
+ * \param   count   The number of components.
+ *
+ * Both operands are widened block by block to `float` and the updated block is
+ * narrowed back into `y`, such that each component is rounded to the storage
+ * type only once.
+ */
+
+template <typename T>
+inline void kernel_axpby (const float       alpha,
+                          const T *         x,
+                          const float       beta,
+                          T *               y,
+                          const dimension_t count) noexcept
+{
+    float buffer_x [kernel_block];
+    float buffer_y [kernel_block];
+
+    for (dimension_t i = 0x0; i < count; i += kernel_block)
+    {
+        const dimension_t   block   = min (count - i, kernel_block);
+        const float *       u       = kernel_as_float (x + i, buffer_x, block);
+
+        kernel_convert (y + i, buffer_y, block);
+        kernel_axpby (alpha, u, beta, buffer_y, block);
+        kernel_convert (buffer_y, y + i, block);
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Scale a vector of a reduced precision in place.
+ * \param   alpha   The factor to scale with.
+ * \param   x       The vector to scale.
+ * \param   count   The number of components.
+ *
+ * The vector is widened block by block to `float` and the scaled block is
+ * narrowed back into `x`.
+ */
+
+template <typename T>
+inline void kernel_scale (const float       alpha,
+                          T *               x,
+                          const dimension_t count) noexcept
+{
+    float buffer [kernel_block];
+
+    for (dimension_t i = 0x0; i < count; i += kernel_block)
+    {
+        const dimension_t block = min (count - i, kernel_block);
+
+        kernel_convert (x + i, buffer, block);
+        kernel_scale   (alpha, buffer, block);
+        kernel_convert (buffer, x + i, block);
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Combine two vectors of a reduced precision element by element.
+ * \param   op      The operation to perform.
+ * \param   a       The first operand.
+ * \param   b       The second operand, either of the type of the first one or
+ *                  `float`.
+ * \param   out     The buffer to write the results to.
+ * \param   count   The number of components.
+ *
+ * The operands are widened block by block to `float` and the results are
+ * narrowed into `out`, which may alias either operand.
+ */
+
+template <typename T, typename U>
+inline void kernel_binary (const kernel_op_t    op,
+                           const T *            a,
+                           const U *            b,
+                           T *                  out,
+                           const dimension_t    count) noexcept
+{
+    float buffer_a [kernel_block];
+    float buffer_b [kernel_block];
+
+    for (dimension_t i = 0x0; i < count; i += kernel_block)
+    {
+        const dimension_t   block   = min (count - i, kernel_block);
+        const float *       y       = kernel_as_float (b + i, buffer_b, block);
+
+        kernel_convert (a + i, buffer_a, block);
+        kernel_binary  (op, buffer_a, y, buffer_a, block);
+        kernel_convert (buffer_a, out + i, block);
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Clamp a vector of a reduced precision element by element.
+ * \param   lower   The lower bound.
+ * \param   upper   The upper bound.
+ * \param   in      The operand.
+ * \param   out     The buffer to write the results to.
+ * \param   count   The number of components.
+ *
+ * The operand is widened block by block to `float` and the results are
+ * narrowed into `out`, which may alias the operand.
+ */
+
+template <typename T>
+inline void kernel_clamp (const float       lower,
+                          const float       upper,
+                          const T *         in,
+                          T *               out,
+                          const dimension_t count) noexcept
+{
+    float buffer [kernel_block];
+
+    for (dimension_t i = 0x0; i < count; i += kernel_block)
+    {
+        const dimension_t block = min (count - i, kernel_block);
+
+        kernel_convert (in + i, buffer, block);
+        kernel_clamp   (lower, upper, buffer, buffer, block);
+        kernel_convert (buffer, out + i, block);
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Transform a vector of a reduced precision element by element.
+ * \param   op      The operation to perform.
+ * \param   in      The operand.
+ * \param   out     The buffer to write the results to.
+ * \param   count   The number of components.
+ *
+ * The operand is widened block by block to `float` and the results are
+ * narrowed into `out`, which may alias the operand.
+ */
+
+template <typename T>
+inline void kernel_unary (const kernel_op_t op,
+                          const T *         in,
+                          T *               out,
+                          const dimension_t count) noexcept
+{
+    float buffer [kernel_block];
+
+    for (dimension_t i = 0x0; i < count; i += kernel_block)
+    {
+        const dimension_t block = min (count - i, kernel_block);
+
+        kernel_convert (in + i, buffer, block);
+        kernel_unary   (op, buffer, buffer, block);
+        kernel_convert (buffer, out + i, block);
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Compare two mixed-precision vectors approximately.
+ * \param   a           The first vector's components.
+ * \param   b           The second vector's components.
+ * \param   count       The number of components.
+ * \param   absolute    The absolute tolerance.
+ * \param   relative    The tolerance relative to the larger magnitude.
+ * \param   ulps        The tolerance in units in the last place of `float`.
+ * \return  Whether all components are close to each other.
+ *
+ * The operands are converted block by block to `float`.  The comparison stops
+ * with the first block which differs.
+ */
+
+template <typename T, typename U>
+inline bool kernel_approx_equal (const T *          a,
+                                 const U *          b,
+                                 const dimension_t  count,
+                                 const float        absolute,
+                                 const float        relative,
+                                 const uint32_t     ulps) noexcept
+{
+    float buffer_a [kernel_block];
+    float buffer_b [kernel_block];
+
+    for (dimension_t i = 0x0; i < count; i += kernel_block)
+    {
+        const dimension_t   block   = min (count - i, kernel_block);
+        const float *       x       = kernel_as_float (a + i, buffer_a, block);
+        const float *       y       = kernel_as_float (b + i, buffer_b, block);
+
+        if (! kernel_approx_equal (x, y, block, absolute, relative, ulps))
+            return false;
+    };
+
+    return true;
+}
+
+
+
+/**
+ * \brief   Compare two mixed-precision vectors exactly.
+ * \param   a       The first vector's components.
+ * \param   b       The second vector's components.
+ * \param   count   The number of components.
+ * \return  Whether no component is less or greater than its counterpart.
+ *
+ * The operands are converted block by block to `float`.  The comparison stops
+ * with the first block which differs.
+ */
+
+template <typename T, typename U>
+inline bool kernel_equal (const T * a, const U * b, const dimension_t count)
+    noexcept
+{
+    float buffer_a [kernel_block];
+    float buffer_b [kernel_block];
+
+    for (dimension_t i = 0x0; i < count; i += kernel_block)
+    {
+        const dimension_t   block   = min (count - i, kernel_block);
+        const float *       x       = kernel_as_float (a + i, buffer_a, block);
+        const float *       y       = kernel_as_float (b + i, buffer_b, block);
+
+        if (! kernel_equal (x, y, block))
+            return false;
+    };
+
+    return true;
+}
+
+
+
+/**
+ * \brief   Canonicalise components of a reduced precision.
+ * \param   in      The components to canonicalise.
+ * \param   out     The buffer to write the canonical `float` components to.
+ * \param   count   The number of components.
+ *
+ * The components are widened to `float` and canonicalised afterwards.
+ */
+
+template <typename T>
+inline void kernel_canonicalise (const T *          in,
+                                 float *            out,
+                                 const dimension_t  count) noexcept
+{
+    kernel_convert      (in, out, count);
+    kernel_canonicalise (out, out, count);
+    return;
+}
+
+
+
+/**
+ * \brief   The content hash of canonicalised components.
+ * \param   in      The components to hash.
+ * \param   count   The number of components.
+ * \param   seed    The seed to start with.
+ * \return  The hash.
+ *
+ * The components are converted block by block to their scalar type and
+ * canonicalised before they are hashed.  Hence, vectors of the same scalar type
+ * which compare equal share their hash unless they contain NaN; this includes
+ * the reduced precisions, which are hashed as `float`.  Vectors of `double`
+ * components are hashed as such and do not share their hashes with the others.
+ */
+
+template <typename T>
+inline uint64_t kernel_hash_canonical (const T *            in,
+                                       const dimension_t    count,
+                                       const uint64_t       seed) noexcept
+{
+    typedef typename Rnpp_traits <T> :: scalar_t scalar_t;
+
+    scalar_t        buffer  [kernel_block];
+    uint64_t        acc     [kernel_hash_lanes];
+    dimension_t     bytes   = 0x0;
+    dimension_t     stripes = 0x0;
+
+    kernel_hash_init (acc, seed);
+
+    for (dimension_t i = 0x0; i < count; i += kernel_block)
+    {
+        const dimension_t block = min (count - i, kernel_block);
+
+        kernel_canonicalise (in + i, buffer, block);
+
+        bytes = block * sizeof (scalar_t);
+        kernel_hash_update (acc, buffer, bytes / kernel_hash_stripe, stripes);
+        stripes += bytes / kernel_hash_stripe;
+    };
+
+    return kernel_hash_final (acc,
+                              (const unsigned char *) buffer
+                                  + bytes / kernel_hash_stripe
+                                  * kernel_hash_stripe,
+                              bytes % kernel_hash_stripe,
+                              count * sizeof (scalar_t), stripes);
+}
+
+
+
+/**
+ * \brief   The squared Euclidean distance of two mixed-precision vectors.
+ * \param   a       The first vector's components.
+ * \param   b       The second vector's components.
+ * \param   count   The number of components.
+ * \return  The squared Euclidean distance.
+ *
+ * The operands are converted block by block to `float` and the partial results
+ * are accumulated in `float`.
+ */
+
+template <typename T, typename U>
+inline float kernel_distance_squared (const T *         a,
+                                      const U *         b,
+                                      const dimension_t count) noexcept
+{
+    float buffer_a [kernel_block];
+    float buffer_b [kernel_block];
+    float ret = 0x0;
+
+    for (dimension_t i = 0x0; i < count; i += kernel_block)
+    {
+        const dimension_t   block   = min (count - i, kernel_block);
+        const float *       x       = kernel_as_float (a + i, buffer_a, block);
+        const float *       y       = kernel_as_float (b + i, buffer_b, block);
+
+        ret += kernel_distance_squared (x, y, block);
+    };
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   The inner product of two mixed-precision vectors.
+ * \param   a       The first vector's components.
+ * \param   b       The second vector's components.
+ * \param   count   The number of components.
+ * \return  The inner product.
+ *
+ * The operands are converted block by block to `float` and the partial results
+ * are accumulated in `float`.
+ */
+
+template <typename T, typename U>
+inline float kernel_inner (const T * a, const U * b, const dimension_t count)
+    noexcept
+{
+    float buffer_a [kernel_block];
+    float buffer_b [kernel_block];
+    float ret = 0x0;
+
+    for (dimension_t i = 0x0; i < count; i += kernel_block)
+    {
+        const dimension_t   block   = min (count - i, kernel_block);
+        const float *       x       = kernel_as_float (a + i, buffer_a, block);
+        const float *       y       = kernel_as_float (b + i, buffer_b, block);
+
+        ret += kernel_inner (x, y, block);
+    };
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Factorise rows of a reduced precision.
+ * \param   rows        The rows to orthonormalise in place.
+ * \param   count       The number of rows, at most `dimension`.
+ * \param   dimension   The number of components per row.
+ * \param   r           The buffer to write the `count * count` factor to.
+ *
+ * The rows are widened to `float` before the factorisation and narrowed
+ * afterwards, such that the reflections do not accumulate rounding errors of
+ * the storage type.
+ */
+
+template <typename T>
+inline void kernel_householder (T *                 rows,
+                                const dimension_t   count,
+                                const dimension_t   dimension,
+                                float *             r)
+{
+    fvec_t buffer = fvec_t (count * dimension);
+
+    kernel_convert (rows, buffer.data (), count * dimension);
+    kernel_householder (buffer.data (), count, dimension, r);
+    kernel_convert (buffer.data (), rows, count * dimension);
+
+    return;
+}
+
+
+
+/**
+ * \brief   Orthonormalise rows of a reduced precision.
+ * \param   rows        The rows to orthonormalise in place.
+ * \param   count       The number of rows.
+ * \param   dimension   The number of components per row.
+ * \return  The number of linearly independent rows.
+ *
+ * The rows are widened to `float` before the orthonormalisation and narrowed
+ * afterwards, such that the projections do not accumulate rounding errors of
+ * the storage type.
+ */
+
+template <typename T>
+inline dimension_t kernel_orthonormalise (T *                 rows,
+                                          const dimension_t   count,
+                                          const dimension_t   dimension)
+{
+    fvec_t              buffer  = fvec_t (count * dimension);
+    dimension_t         ret     = 0x0;
+
+    kernel_convert (rows, buffer.data (), count * dimension);
+    ret = kernel_orthonormalise (buffer.data (), count, dimension);
+    kernel_convert (buffer.data (), rows, count * dimension);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   The number of workers to distribute a loop across.
+ * \param   count   The number of iterations.
+ * \param   threads The maximal number of threads, zero for the hardware ones.
+ * \return  The number of ranges `kernel_parallel_for` splits the loop into.
+ *
+ * Partitionings which need to match each other, like the placement of a batch
+ * and the scans over it, derive their ranges from this number.
+ */
+
+inline dimension_t kernel_workers (const dimension_t count,
+                                   const dimension_t threads) noexcept
+{
+    const dimension_t cores = std :: thread :: hardware_concurrency ();
+
+    return max (min (threads ? threads : cores, count), dimension_t (0x1));
+}
+
+
+
+/**
+ * \brief   Distribute a loop across several threads.
+ * \param   count   The number of iterations.
+ * \param   threads The maximal number of threads to use.
+ * \param   body    The function to call for each range of iterations.
+ *
+ * The iterations are split into contiguous ranges of similar length, one per
+ * thread.  `body` is called as `body (begin, end, worker)` with the half-open
+ * range [begin, end) and the index of the calling worker which is less than
+ * `threads`.  The calling thread takes over the first range itself and returns
+ * after all ranges are done.  Hence, `body` must not throw.
+ */
+
+template <typename F>
+inline void kernel_parallel_for (const dimension_t  count,
+                                 const dimension_t  threads,
+                                 const F &          body)
+{
+    const dimension_t           workers = max (min (threads, count),
+                                               dimension_t (0x1));
+    vector <std :: thread>      pool;
+
+    pool.reserve (workers - 0x1);
+
+#if ! defined (__RNFPP_NO_EXCEPTIONS__)
+    try
+    {
+#endif  // ! __RNFPP_NO_EXCEPTIONS__
+        for (dimension_t w = 0x1; w < workers; w++)
+            pool.push_back (std :: thread (body, count * w / workers,
+                                           count * (w + 0x1) / workers, w));
+#if ! defined (__RNFPP_NO_EXCEPTIONS__)
+    }
+    catch (...)
+    {
+        for (dimension_t w = 0x0; w < pool.size (); w++)
+            pool[w].join ();
+
+        throw;
+    };
+#endif  // ! __RNFPP_NO_EXCEPTIONS__
+
+    body (dimension_t (0x0), count / workers, dimension_t (0x0));
+
+    for (dimension_t w = 0x0; w < pool.size (); w++)
+        pool[w].join ();
+
+    return;
+}
+
+
+
+/**
+ * \brief   Draw the next pseudo random number.
+ * \param   state   The state of the generator.
+ * \return  The next pseudo random number.
+ *
+ * This is the SplitMix64 generator.  It is implemented here since the engines
+ * and distributions of the C++ standard library are not guaranteed to yield
+ * the same sequences with all implementations; results derived from a seed
+ * shall be reproducible, regardless of the platform.
+ */
+
+inline uint64_t kernel_random (uint64_t & state) noexcept
+{
+    uint64_t ret = state += 0x9e3779b97f4a7c15;
+
+    ret = (ret ^ (ret >> 0x1e)) * 0xbf58476d1ce4e5b9;
+    ret = (ret ^ (ret >> 0x1b)) * 0x94d049bb133111eb;
+
+    return ret ^ (ret >> 0x1f);
+}
+
+
+
+/**
+ * \brief   Draw the next uniformly distributed number.
+ * \param   state   The state of the generator.
+ * \return  A pseudo random number in [0, 1).
+ *
+ * The upper 53 bits of the next pseudo random number form the mantissa.
+ */
+
+inline double kernel_uniform (uint64_t & state) noexcept
+{
+    return double (kernel_random (state) >> 0xb) / 9007199254740992.0;
+}
+
+
+
+/**
+ * \brief   Draw the next standard normally distributed number.
+ * \param   state   The state of the generator.
+ * \return  The next pseudo random number.
+ *
+ * Two uniform numbers are transformed with the Box-Muller method.  The first
+ * one is reflected to (0, 1] such that the logarithm is never taken from zero.
+ */
+
+inline double kernel_normal (uint64_t & state) noexcept
+{
+    const double u = 1.0 - kernel_uniform (state);
+    const double v = kernel_uniform (state);
+
+    return sqrt (- 2.0 * log (u)) * cos (6.283185307179586 * v);
+}
+
+
+
+/*
+ * End of header.
+ */
+
+// Leaving the header.
+#endif  // ! __KERNELS_HPP__
+
+/******************************************************************************/
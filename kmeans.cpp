@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The k-means class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kmeans.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the k-means class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Construct a new Rnpp_kmeans object.
+ *
+ * This is the default constructor which will prepare a clustering without any
+ * clusters.
+ */
+
+Rnpp_kmeans :: Rnpp_kmeans (void)
+    : clusters (0x0), dimension (0x0), inertia (0x0), seed (0x0)
+{
+    this -> set_threads (0x0);
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp_kmeans object.
+ * \param   clusters    The number of clusters to partition batches into.
+ * \param   seed        The seed of the random choices.
+ * \throws  invalid_argument    In case of no clusters.
+ *
+ * This constructor prepares a clustering which will use all available cores.
+ * Equal seeds will yield equal clusterings of equal batches.
+ */
+
+Rnpp_kmeans :: Rnpp_kmeans (const dimension_t clusters, const uint64_t seed)
+    : clusters (clusters), dimension (0x0), inertia (0x0), seed (seed)
+{
+    if (! clusters)
+        RNPP_VIOLATION (invalid_argument,
+                        "A clustering requires at least one cluster!");
+
+    this -> set_threads (0x0);
+    return;
+}
+
+
+
+/**
+ * \brief   Destruct an Rnpp_kmeans object.
+ *
+ * This is the default destructor.
+ */
+
+Rnpp_kmeans :: ~Rnpp_kmeans (void)
+{
+    return;
+}
+
+/******************************************************************************/
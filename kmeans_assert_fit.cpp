@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The k-means class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kmeans_assert_fit.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the k-means class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Ensure a batch to be suitable for a clustering.
+ * \param   batch   The batch to test.
+ * \throws  invalid_argument    In case the batch cannot be clustered.
+ *
+ * This method tests whether there are clusters to fit and whether the given
+ * batch holds at least one non-empty row per cluster.  If not so, an exception
+ * will be thrown.
+ */
+
+void Rnpp_kmeans :: assert_fit (const Rnfpp_batch & batch) const
+{
+    if (! this -> clusters || ! batch.get_dimension ())
+        RNPP_VIOLATION (invalid_argument, "There is nothing to cluster!");
+
+    if (batch.get_count () < this -> clusters)
+        RNPP_VIOLATION (invalid_argument,
+                        "The batch holds fewer rows than clusters!");
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The k-means class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kmeans_assign.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the k-means class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Assign the rows of a batch to their nearest centroids.
+ * \param   batch   The batch to assign.
+ * \return  The index of the nearest centroid of each row, in order.
+ * \throws  invalid_argument    In case of a different dimension.
+ *
+ * This method determines the nearest centroid of each row of the given batch
+ * without changing the centroids.
+ */
+
+vector <dimension_t> Rnpp_kmeans :: assign (const Rnfpp_batch & batch) const
+{
+    this -> assert_same_dimension (batch);
+
+    const dimension_t       count       = batch.get_count ();
+    fvec_t                  distances   = fvec_t (count);
+    vector <dimension_t>    ret         = vector <dimension_t> (count);
+
+    this -> nearest (batch.get_components ().data (), count, ret.data (),
+                     distances.data ());
+
+    return ret;
+}
+
+/******************************************************************************/
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The k-means class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kmeans_fit.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the k-means class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: chrono :: duration;
+using std :: chrono :: steady_clock;
+using std :: fill;
+using std :: max_element;
+using std :: numeric_limits;
+
+
+
+/**
+ * \brief   Cluster a batch by Lloyd's algorithm.
+ * \param   batch       The batch to cluster.
+ * \param   iterations  The maximal number of iterations.
+ * \param   tolerance   The largest squared shift of a centroid to stop at.
+ * \throws  invalid_argument    In case the batch cannot be clustered.
+ *
+ * After seeding the centroids by k-means++, each iteration assigns all rows to
+ * their nearest centroids and moves each centroid to the mean of its rows.
+ * Both steps are distributed across the threads:  each thread sums up the rows
+ * of its range per cluster and the partial sums are reduced per cluster.  A
+ * cluster which lost all of its rows is moved to the row farthest from its
+ * centroid.  The iterations stop as soon as no centroid moves farther than the
+ * tolerance.  Finally, the rows are assigned once more in order to determine
+ * the inertia.
+ */
+
+void Rnpp_kmeans :: fit (const Rnfpp_batch & batch,
+                         const dimension_t   iterations,
+                         const float         tolerance)
+{
+    this -> assert_fit (batch);
+    this -> dimension = batch.get_dimension ();
+    this -> timings.clear ();
+
+    const dimension_t       d           = this -> dimension;
+    const dimension_t       k           = this -> clusters;
+    const dimension_t       n           = batch.get_count ();
+    const dimension_t       workers     = min (this -> threads, n);
+    const float *           x           = batch.get_components ().data ();
+    fvec_t                  distances   = fvec_t (n);
+    vector <dimension_t>    labels      = vector <dimension_t> (n);
+    fvec_t                  shifts      = fvec_t (k);
+    vector <dimension_t>    sizes       = vector <dimension_t> (workers * k);
+    uint64_t                state       = this -> seed;
+    vector <double>         sums        = vector <double> (workers * k * d);
+
+    this -> initialise (batch, state);
+
+    for (dimension_t iteration = 0x0; iteration < iterations; iteration++)
+    {
+        const steady_clock :: time_point start = steady_clock :: now ();
+
+        this -> nearest (x, n, labels.data (), distances.data ());
+
+        kernel_parallel_for (n, workers, [&] (const dimension_t begin,
+                                              const dimension_t end,
+                                              const dimension_t worker)
+        {
+            double *        sum     = sums.data () + worker * k * d;
+            dimension_t *   size    = sizes.data () + worker * k;
+
+            fill (sum, sum + k * d, 0.0);
+            fill (size, size + k, dimension_t (0x0));
+
+            for (dimension_t i = begin; i < end; i++)
+            {
+                const float *   row     = x + i * d;
+                double *        target  = sum + labels[i] * d;
+
+                for (dimension_t j = 0x0; j < d; j++)
+                    target[j] += row[j];
+
+                size[labels[i]]++;
+            };
+        });
+
+        kernel_parallel_for (k, workers, [&] (const dimension_t begin,
+                                              const dimension_t end,
+                                              const dimension_t)
+        {
+            for (dimension_t c = begin; c < end; c++)
+            {
+                float *     centroid    = this -> centroids.data () + c * d;
+                float       shift       = 0x0;
+                dimension_t size        = 0x0;
+
+                for (dimension_t w = 0x0; w < workers; w++)
+                    size += sizes[w * k + c];
+
+                for (dimension_t j = 0x0; size && j < d; j++)
+                {
+                    double mean = 0x0;
+
+                    for (dimension_t w = 0x0; w < workers; w++)
+                        mean += sums[(w * k + c) * d + j];
+
+                    const float value = float (mean / double (size));
+                    const float delta = value - centroid[j];
+
+                    shift       += delta * delta;
+                    centroid[j] = value;
+                };
+
+                shifts[c] = size ? shift : numeric_limits <float> :: max ();
+            };
+        });
+
+        for (dimension_t c = 0x0; c < k; c++)
+            if (shifts[c] == numeric_limits <float> :: max ())
+            {
+                float *             first   = distances.data ();
+                float *             far     = max_element (first, first + n);
+                const dimension_t   index   = dimension_t (far - first);
+
+                memcpy (this -> centroids.data () + c * d, x + index * d,
+                        d * sizeof (float));
+                * far = 0x0;
+            };
+
+        this -> timings.push_back (duration <double> (steady_clock :: now ()
+                                                      - start).count ());
+
+        if (* max_element (shifts.begin (), shifts.end ()) <= tolerance)
+            break;
+    };
+
+    this -> inertia = this -> nearest (x, n, labels.data (), distances.data ());
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The k-means class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kmeans_fit_mini_batch.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the k-means class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <chrono>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: chrono :: duration;
+using std :: chrono :: steady_clock;
+
+
+
+/**
+ * \brief   Cluster a batch by mini-batch updates.
+ * \param   batch       The batch to cluster.
+ * \param   iterations  The number of iterations.
+ * \param   size        The number of rows to sample per iteration.
+ * \throws  invalid_argument    In case the batch cannot be clustered.
+ *
+ * After seeding the centroids by k-means++, each iteration draws `size` rows at
+ * random, assigns them to their nearest centroids in parallel and moves each
+ * centroid towards its rows with a learning rate of one over the number of
+ * rows it was assigned so far.  This trades some inertia for iterations which
+ * do not depend on the size of the batch.  Finally, all rows are assigned once
+ * in order to determine the inertia.
+ */
+
+void Rnpp_kmeans :: fit_mini_batch (const Rnfpp_batch & batch,
+                                    const dimension_t   iterations,
+                                    const dimension_t   size)
+{
+    this -> assert_fit (batch);
+
+    if (! size)
+        RNPP_VIOLATION (invalid_argument,
+                        "A mini-batch requires at least one row!");
+
+    this -> dimension = batch.get_dimension ();
+    this -> timings.clear ();
+
+    const dimension_t       d           = this -> dimension;
+    const dimension_t       k           = this -> clusters;
+    const dimension_t       n           = batch.get_count ();
+    const float *           x           = batch.get_components ().data ();
+    vector <dimension_t>    counts      = vector <dimension_t> (k);
+    fvec_t                  distances   = fvec_t (size);
+    vector <dimension_t>    labels      = vector <dimension_t> (size);
+    fvec_t                  sample      = fvec_t (size * d);
+    uint64_t                state       = this -> seed;
+
+    this -> initialise (batch, state);
+
+    for (dimension_t iteration = 0x0; iteration < iterations; iteration++)
+    {
+        const steady_clock :: time_point start = steady_clock :: now ();
+
+        for (dimension_t s = 0x0; s < size; s++)
+            memcpy (sample.data () + s * d,
+                    x + dimension_t (kernel_random (state) % n) * d,
+                    d * sizeof (float));
+
+        this -> nearest (sample.data (), size, labels.data (),
+                         distances.data ());
+
+        for (dimension_t s = 0x0; s < size; s++)
+        {
+            const float *   row         = sample.data () + s * d;
+            float *         centroid    = this -> centroids.data ()
+                                        + labels[s] * d;
+            const float     rate        = 1.0f / float (++counts[labels[s]]);
+
+            for (dimension_t j = 0x0; j < d; j++)
+                centroid[j] += rate * (row[j] - centroid[j]);
+        };
+
+        this -> timings.push_back (duration <double> (steady_clock :: now ()
+                                                      - start).count ());
+    };
+
+    distances   = fvec_t (n);
+    labels      = vector <dimension_t> (n);
+
+    this -> inertia = this -> nearest (x, n, labels.data (), distances.data ());
+    return;
+}
+
+/******************************************************************************/
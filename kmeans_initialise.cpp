@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The k-means class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kmeans_initialise.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the k-means class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Seed the centroids by k-means++.
+ * \param   batch   The batch to cluster.
+ * \param   state   The state of the random number generator.
+ *
+ * The first centroid is a row chosen uniformly at random.  Each further
+ * centroid is a row chosen with a probability proportional to its squared
+ * distance to the nearest centroid so far, which spreads the centroids across
+ * the batch.  The distances are updated in parallel after each choice.
+ */
+
+void Rnpp_kmeans :: initialise (const Rnfpp_batch & batch, uint64_t & state)
+{
+    const dimension_t   d       = this -> dimension;
+    const dimension_t   k       = this -> clusters;
+    const dimension_t   n       = batch.get_count ();
+    const float *       x       = batch.get_components ().data ();
+    dimension_t         index   = dimension_t (kernel_random (state) % n);
+    fvec_t              closest = fvec_t (n);
+
+    this -> centroids = fvec_t (k * d);
+
+    for (dimension_t c = 0x0; c < k; c++)
+    {
+        if (c)
+        {
+            double total = 0x0;
+
+            for (dimension_t i = 0x0; i < n; i++)
+                total += closest[i];
+
+            if (total > 0x0)
+            {
+                double target = kernel_uniform (state) * total;
+
+                for (dimension_t i = 0x0; i < n; i++)
+                    if (closest[i] > 0x0)
+                    {
+                        index = i;
+                        target -= closest[i];
+
+                        if (target < 0x0)
+                            break;
+                    };
+            }
+            else
+                index = dimension_t (kernel_random (state) % n);
+        };
+
+        float * centroid = this -> centroids.data () + c * d;
+
+        memcpy (centroid, x + index * d, d * sizeof (float));
+
+        if (c + 0x1 == k)
+            break;
+
+        kernel_parallel_for (n, this -> threads, [&] (const dimension_t begin,
+                                                      const dimension_t end,
+                                                      const dimension_t)
+        {
+            for (dimension_t i = begin; i < end; i++)
+            {
+                const float distance = kernel_distance_squared (x + i * d,
+                                                                centroid, d);
+
+                closest[i] = c ? min (closest[i], distance) : distance;
+            };
+        });
+    };
+
+    return;
+}
+
+/******************************************************************************/
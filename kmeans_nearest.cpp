@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The k-means class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        kmeans_nearest.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the k-means class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <limits>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: numeric_limits;
+
+
+
+/**
+ * \brief   Assign rows to their nearest centroids.
+ * \param   rows        The components of the rows to assign.
+ * \param   count       The number of rows.
+ * \param   labels      The buffer to write the nearest centroids to.
+ * \param   distances   The buffer to write the squared distances to.
+ * \return  The sum of the squared distances.
+ *
+ * The squared distance of a row `x` to a centroid `c` is computed as
+ * `|x|^2 - 2 <x, c> + |c|^2`.  The inner products of a panel of rows with all
+ * centroids are obtained at once by the matrix kernel, such that the centroids
+ * are streamed from the cache rather than from memory.  The rows are split
+ * into one contiguous range per thread.
+ */
+
+double Rnpp_kmeans :: nearest (const float *       rows,
+                               const dimension_t   count,
+                               dimension_t *       labels,
+                               float *             distances) const
+{
+    const dimension_t   d       = this -> dimension;
+    const dimension_t   k       = this -> clusters;
+    const float *       c       = this -> centroids.data ();
+    const dimension_t   panel   = max (min (kernel_panel, kernel_tile / k),
+                                       dimension_t (0x4));
+    const dimension_t   workers = max (min (this -> threads, count),
+                                       dimension_t (0x1));
+    fvec_t              norms   = fvec_t (k);
+    vector <double>     sums    = vector <double> (workers);
+    fvec_t              buffer  = fvec_t (workers * panel * k);
+
+    for (dimension_t j = 0x0; j < k; j++)
+        norms[j] = kernel_inner (c + j * d, c + j * d, d);
+
+    kernel_parallel_for (count, workers, [&] (const dimension_t begin,
+                                              const dimension_t end,
+                                              const dimension_t worker)
+    {
+        float * products    = buffer.data () + worker * panel * k;
+        double  sum         = 0x0;
+
+        for (dimension_t i = begin; i < end; i += panel)
+        {
+            const dimension_t block = min (end - i, panel);
+
+            kernel_inner_matrix (rows + i * d, block, c, k, d, products);
+
+            for (dimension_t r = 0x0; r < block; r++)
+            {
+                const float *   x       = rows + (i + r) * d;
+                const float *   p       = products + r * k;
+                dimension_t     best    = 0x0;
+                float           value   = numeric_limits <float> :: max ();
+
+                for (dimension_t j = 0x0; j < k; j++)
+                    if (norms[j] - 0x2 * p[j] < value)
+                    {
+                        best    = j;
+                        value   = norms[j] - 0x2 * p[j];
+                    };
+
+                value = max (value + kernel_inner (x, x, d), 0.0f);
+
+                labels[i + r]       = best;
+                distances[i + r]    = value;
+                sum                 += value;
+            };
+        };
+
+        sums[worker] = sum;
+    });
+
+    double ret = 0x0;
+
+    for (dimension_t w = 0x0; w < workers; w++)
+        ret += sums[w];
+
+    return ret;
+}
+
+/******************************************************************************/
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnfpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        lerp.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnfpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Interpolate linearly between this vector and another one.
+ * \param   x   The other vector.
+ * \param   t   The position between this vector, at zero, and the other one,
+ *              at one.
+ * \return  This vector.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method computes `this = t * x + (1 - t) * this` in place.  Both ends
+ * of the interval are met exactly:  this vector is kept for a `t` of zero
+ * and becomes a copy of the other one for a `t` of one.
+ */
+
+template <typename T>
+Rnpp <T> & Rnpp <T> :: lerp (const Rnpp <T> & x, const scalar_t t)
+{
+    return this -> axpby (t, x, scalar_t (0x1) - t);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp & Rnbpp :: lerp (const Rnbpp &, const float);
+
+template Rndpp & Rndpp :: lerp (const Rndpp &, const double);
+
+template Rnfpp & Rnfpp :: lerp (const Rnfpp &, const float);
+
+template Rnhpp & Rnhpp :: lerp (const Rnhpp &, const float);
+
+/******************************************************************************/
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnfpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        minimum.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnfpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Determine the element-wise minimum with another vector.
+ * \param   other   The other vector.
+ * \return  The vector of the smaller components.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method returns a new vector of the element-wise smaller components of
+ * this vector and the other one.  If two components are unordered, the one of
+ * this vector is kept.
+ */
+
+template <typename T>
+Rnpp <T> Rnpp <T> :: minimum (const Rnpp <T> & other) const
+{
+    this -> assert_same_dimension (other);
+
+    Rnpp <T> ret = Rnpp <T> (this -> get_dimension ());
+
+    kernel_binary (kernel_minimum, this -> components.data (),
+                   other.components.data (), ret.components.data (),
+                   this -> get_dimension ());
+    return ret;
+}
+
+
+
+/**
+ * \brief   Determine the element-wise minimum with another vector.
+ * \param   other   The other vector.
+ * \return  This vector.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method replaces the components of this vector by their element-wise
+ * smaller components with the components of the other vector in a single pass.
+ */
+
+template <typename T>
+Rnpp <T> & Rnpp <T> :: minimum_inplace (const Rnpp <T> & other)
+{
+    this -> assert_same_dimension (other);
+    kernel_binary (kernel_minimum, this -> components.data (),
+                   other.components.data (), this -> components.data (),
+                   this -> get_dimension ());
+    return (* this);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp Rnbpp :: minimum (const Rnbpp &) const;
+template Rnbpp & Rnbpp :: minimum_inplace (const Rnbpp &);
+
+template Rndpp Rndpp :: minimum (const Rndpp &) const;
+template Rndpp & Rndpp :: minimum_inplace (const Rndpp &);
+
+template Rnfpp Rnfpp :: minimum (const Rnfpp &) const;
+template Rnfpp & Rnfpp :: minimum_inplace (const Rnfpp &);
+
+template Rnhpp Rnhpp :: minimum (const Rnhpp &) const;
+template Rnhpp & Rnhpp :: minimum_inplace (const Rnhpp &);
+
+/******************************************************************************/
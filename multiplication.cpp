@@ -48,14 +48,27 @@
  * This method will scale this vector by the given scalar.
  */
 
-Rnfpp Rnfpp :: operator * (const float other) const noexcept
+template <typename T>
+Rnpp <T> Rnpp <T> :: operator * (const scalar_t other) const noexcept
 {
-    Rnfpp ret = Rnfpp (this -> get_dimension ());
-
-    for (dimension_t i = 0x0; i < this -> get_dimension (); i++)
-        ret[i] = (* this)[i] * other;
+    Rnpp <T> ret = (* this);
 
+    ret *= other;
     return ret;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp Rnbpp :: operator * (const float) const noexcept;
+
+template Rndpp Rndpp :: operator * (const double) const noexcept;
+
+template Rnfpp Rnfpp :: operator * (const float) const noexcept;
+
+template Rnhpp Rnhpp :: operator * (const float) const noexcept;
+
 /******************************************************************************/
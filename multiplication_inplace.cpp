@@ -36,22 +36,39 @@
  */
 
 // This project.
-#include "Rnfpp.hpp"
+#include "kernels.hpp"
 
 
 
 /**
- * \brief   The multiplication operator.
+ * \brief   The multiplication assignment operator.
  * \param   other   The scalar to scale this vector with.
- * \return  The scaled vector.
+ * \return  This vector.
  *
- * This method will scale this vector by the given scalar.
+ * This method will scale this vector by the given scalar.  The components are
+ * updated in place without allocating memory.
  */
 
-Rnfpp & Rnfpp :: operator *= (const float other) noexcept
+template <typename T>
+Rnpp <T> & Rnpp <T> :: operator *= (const scalar_t other) noexcept
 {
-    this -> set_components ((* this) * other);
+    KERNEL_PROFILE (Rnpp_multiplication, this -> get_dimension (), 0x0);
+    kernel_scale (other, this -> components.data (), this -> get_dimension ());
     return (* this);
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp & Rnbpp :: operator *= (const float) noexcept;
+
+template Rndpp & Rndpp :: operator *= (const double) noexcept;
+
+template Rnfpp & Rnfpp :: operator *= (const float) noexcept;
+
+template Rnhpp & Rnhpp :: operator *= (const float) noexcept;
+
 /******************************************************************************/
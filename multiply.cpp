@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnfpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        multiply.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnfpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Multiply this vector by another one element by element.
+ * \param   other   The other vector.
+ * \return  The vector of the products.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method returns a new vector of the element-wise products of this vector
+ * and the other one.  This is also known as the Hadamard product.
+ */
+
+template <typename T>
+Rnpp <T> Rnpp <T> :: multiply (const Rnpp <T> & other) const
+{
+    this -> assert_same_dimension (other);
+
+    Rnpp <T> ret = Rnpp <T> (this -> get_dimension ());
+
+    kernel_binary (kernel_multiply, this -> components.data (),
+                   other.components.data (), ret.components.data (),
+                   this -> get_dimension ());
+    return ret;
+}
+
+
+
+/**
+ * \brief   Multiply this vector by another one element by element.
+ * \param   other   The other vector.
+ * \return  This vector.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method replaces the components of this vector by their element-wise
+ * products with the components of the other vector in a single pass.
+ */
+
+template <typename T>
+Rnpp <T> & Rnpp <T> :: multiply_inplace (const Rnpp <T> & other)
+{
+    this -> assert_same_dimension (other);
+    kernel_binary (kernel_multiply, this -> components.data (),
+                   other.components.data (), this -> components.data (),
+                   this -> get_dimension ());
+    return (* this);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp Rnbpp :: multiply (const Rnbpp &) const;
+template Rnbpp & Rnbpp :: multiply_inplace (const Rnbpp &);
+
+template Rndpp Rndpp :: multiply (const Rndpp &) const;
+template Rndpp & Rndpp :: multiply_inplace (const Rndpp &);
+
+template Rnfpp Rnfpp :: multiply (const Rnfpp &) const;
+template Rnfpp & Rnfpp :: multiply_inplace (const Rnfpp &);
+
+template Rnhpp Rnhpp :: multiply (const Rnhpp &) const;
+template Rnhpp & Rnhpp :: multiply_inplace (const Rnhpp &);
+
+/******************************************************************************/
@@ -47,9 +47,24 @@
  * This method determines the Euclidean 2-norm of this vector.
  */
 
-float Rnfpp :: norm (void) const noexcept
+template <typename T>
+typename Rnpp <T> :: scalar_t Rnpp <T> :: norm (void) const noexcept
 {
-    return sqrt (pow (this -> inner ((* this)), 0x2));
+    return sqrt (this -> inner ((* this)));
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template float Rnbpp :: norm (void) const noexcept;
+
+template double Rndpp :: norm (void) const noexcept;
+
+template float Rnfpp :: norm (void) const noexcept;
+
+template float Rnhpp :: norm (void) const noexcept;
+
 /******************************************************************************/
@@ -36,21 +36,38 @@
  */
 
 // This project.
-#include "Rnfpp.hpp"
+#include "kernels.hpp"
 
 
 
 /**
  * \brief   Normalise this vector.
  *
- * Normalise this vector by dividing it by its Euclidean 2-norm.
+ * Normalise this vector by dividing it by its Euclidean 2-norm.  The components
+ * are updated in place without allocating memory.
  */
 
-void Rnfpp :: normalise (void)
+template <typename T>
+void Rnpp <T> :: normalise (void)
 {
+    KERNEL_PROFILE (Rnpp_normalise, this -> get_dimension (), 0x0);
     this -> assert_norm_non_zero ();
     (* this) /= this -> norm ();
     return;
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp :: normalise (void);
+
+template void Rndpp :: normalise (void);
+
+template void Rnfpp :: normalise (void);
+
+template void Rnhpp :: normalise (void);
+
 /******************************************************************************/
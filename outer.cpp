@@ -40,6 +40,52 @@
 
 
 
+/**
+ * \brief   The outer product of two component arrays.
+ * \param   x           The components of the first vector.
+ * \param   y           The components of the second vector.
+ * \param   dimension   The dimension of both vectors, either 2 or 3.
+ * \return  The outer product.
+ *
+ * The dimension is supposed to be checked by the caller such that the
+ * components can be read without any further check.
+ */
+
+template <typename T>
+static Rnpp <T> outer_product (const T *          x,
+                               const T *          y,
+                               const dimension_t  dimension)
+{
+    typedef typename Rnpp <T> :: scalar_t   scalar_t;
+    typedef typename Rnpp <T> :: vec_t      vec_t;
+
+    const scalar_t  ox  = y[0x0];
+    const scalar_t  oy  = y[0x1];
+    const scalar_t  tx  = x[0x0];
+    const scalar_t  ty  = x[0x1];
+    vec_t           ret = vec_t (0x3);
+
+    if (dimension == 0x2)
+    {
+        ret[0x0] = scalar_t (0x0);
+        ret[0x1] = scalar_t (0x0);
+        ret[0x2] = tx * oy - ty * ox;
+    }
+    else
+    {
+        const scalar_t  oz  = y[0x2];
+        const scalar_t  tz  = x[0x2];
+
+        ret[0x0] = ty * oz - tz * oy;
+        ret[0x1] = tz * ox - tx * oz;
+        ret[0x2] = tx * oy - ty * ox;
+    };
+
+    return Rnpp <T> (move (ret));
+}
+
+
+
 /**
  * \brief   The outer product of two vectors.
  * \param   other   The vector to calculate the outer product with.
@@ -47,12 +93,15 @@
  * \throws  invalid_argument    In case the vectors are of different dimensions.
  *
  * This method determines the outer product of this vector with the other one.
+ * The dimensions are checked once; the other vector is not copied.
  */
 
-Rnfpp Rnfpp :: outer (const fvec_t & other) const
+template <typename T>
+Rnpp <T> Rnpp <T> :: outer (const vec_t & other) const
 {
     this -> assert_outer_product (other);
-    return this -> outer (Rnfpp (other));
+    return outer_product (this -> components.data (), other.data (),
+                          this -> get_dimension ());
 }
 
 
@@ -64,35 +113,34 @@ Rnfpp Rnfpp :: outer (const fvec_t & other) const
  * \throws  invalid_argument    In case the vectors are of different dimensions.
  *
  * This method determines the outer product of this vector with the other one.
+ * The dimensions are checked once.
  */
 
-Rnfpp Rnfpp :: outer (const Rnfpp & other) const
+template <typename T>
+Rnpp <T> Rnpp <T> :: outer (const Rnpp <T> & other) const
 {
     this -> assert_outer_product (other);
+    return outer_product (this -> components.data (),
+                          other.get_components ().data (),
+                          this -> get_dimension ());
+}
 
-    const float ox  = other[0x0];
-    const float oy  = other[0x1];
-    const float tx  = (* this)[0x0];
-    const float ty  = (* this)[0x1];
-    fvec_t      ret = fvec_t (0x3);
 
-    if (this -> get_dimension () == 0x2)
-    {
-        ret.at (0x0) = 0x0;
-        ret.at (0x1) = 0x0;
-        ret.at (0x2) = tx * oy - ty * ox;
-    }
-    else
-    {
-        const float oz  = other[0x2];
-        const float tz  = (* this)[0x2];
 
-        ret.at (0x0) = ty * oz - tz * oy;
-        ret.at (0x1) = tz * ox - tx * oz;
-        ret.at (0x2) = tx * oy - ty * ox;
-    };
+/*
+ * Explicit instantiations.
+ */
 
-    return Rnfpp (ret);
-}
+template Rnbpp Rnbpp :: outer (const Rnbpp :: vec_t &) const;
+template Rnbpp Rnbpp :: outer (const Rnbpp &) const;
+
+template Rndpp Rndpp :: outer (const Rndpp :: vec_t &) const;
+template Rndpp Rndpp :: outer (const Rndpp &) const;
+
+template Rnfpp Rnfpp :: outer (const Rnfpp :: vec_t &) const;
+template Rnfpp Rnfpp :: outer (const Rnfpp &) const;
+
+template Rnhpp Rnhpp :: outer (const Rnhpp :: vec_t &) const;
+template Rnhpp Rnhpp :: outer (const Rnhpp &) const;
 
 /******************************************************************************/
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The thread pool class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        pool.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the thread pool class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Construct a new Rnpp_pool object.
+ * \param   threads     The number of worker threads.
+ * \param   capacity    The maximal number of queued tasks.
+ * \param   pinned      Whether to pin the workers to the NUMA nodes.
+ * \throws  invalid_argument    In case the capacity is zero.
+ *
+ * This constructor starts the workers at once.  Zero threads will select the
+ * number of hardware threads.  Pinned workers are assigned to the nodes in
+ * contiguous groups like the rows of a placed batch.
+ */
+
+Rnpp_pool :: Rnpp_pool (const dimension_t  threads,
+                        const dimension_t  capacity,
+                        const bool         pinned)
+    : capacity (capacity), stopping (false)
+{
+    if (! capacity)
+        RNPP_VIOLATION (invalid_argument,
+                        "A pool requires a queue of at least one task!");
+
+    const dimension_t cores     = std :: thread :: hardware_concurrency ();
+    const dimension_t workers   = threads ? threads
+                                          : max (cores, dimension_t (0x1));
+
+    this -> workers.reserve (workers);
+
+#if ! defined (__RNFPP_NO_EXCEPTIONS__)
+    try
+    {
+#endif  // ! __RNFPP_NO_EXCEPTIONS__
+        for (dimension_t w = 0x0; w < workers; w++)
+        {
+            const dimension_t node = kernel_numa_node (w, workers);
+
+            this -> workers.push_back (std :: thread (& Rnpp_pool :: work,
+                                                      this, pinned, node));
+        };
+#if ! defined (__RNFPP_NO_EXCEPTIONS__)
+    }
+    catch (...)
+    {
+        this -> stop ();
+        throw;
+    };
+#endif  // ! __RNFPP_NO_EXCEPTIONS__
+
+    return;
+}
+
+
+
+/**
+ * \brief   Destruct an Rnpp_pool object.
+ *
+ * This destructor waits for all queued tasks to complete and joins the workers
+ * afterwards.
+ */
+
+Rnpp_pool :: ~Rnpp_pool (void)
+{
+    this -> stop ();
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The thread pool class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        pool_normalise.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the thread pool class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Normalise the rows of a batch asynchronously.
+ * \param   batch   The batch to normalise.
+ * \return  The future of the normalised batch.
+ *
+ * This method submits `Rnpp_batch :: normalise_inplace`.  The batch is moved
+ * into the task such that the caller may pass a temporary.
+ */
+
+future <Rnfpp_batch> Rnpp_pool :: normalise (Rnfpp_batch batch)
+{
+    const shared_ptr <Rnfpp_batch> shared
+        = make_shared <Rnfpp_batch> (move (batch));
+
+    return this -> submit ([shared] (void)
+                           {
+                               return move (shared -> normalise_inplace ());
+                           });
+}
+
+/******************************************************************************/
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The thread pool class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        pool_push.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the thread pool class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Append a task to the queue.
+ * \param   task    The task to execute.
+ *
+ * In case the queue is full, this method blocks until a worker takes the next
+ * task.
+ */
+
+void Rnpp_pool :: push (function <void (void)> && task)
+{
+    unique_lock <mutex> guard (this -> lock);
+
+    this -> space.wait (guard, [&] (void)
+                               {
+                                   return this -> queue.size ()
+                                        < this -> capacity;
+                               });
+
+    this -> queue.push_back (move (task));
+    guard.unlock ();
+    this -> filled.notify_one ();
+    return;
+}
+
+
+
+/**
+ * \brief   Append a task to the queue unless it is full.
+ * \param   task    The task to execute.
+ * \return  Whether the task has been appended.
+ *
+ * This method never blocks for longer than the queue is locked by another
+ * thread.
+ */
+
+bool Rnpp_pool :: try_push (function <void (void)> && task)
+{
+    unique_lock <mutex> guard (this -> lock);
+
+    if (this -> queue.size () >= this -> capacity)
+        return false;
+
+    this -> queue.push_back (move (task));
+    guard.unlock ();
+    this -> filled.notify_one ();
+    return true;
+}
+
+/******************************************************************************/
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The thread pool class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        pool_work.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the thread pool class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   The loop of a worker.
+ * \param   pinned  Whether to pin this worker to its NUMA node.
+ * \param   node    The NUMA node of this worker.
+ *
+ * Each worker takes the tasks from the front of the queue and executes them
+ * one after another.  A worker returns as soon as the pool is stopping and the
+ * queue has been drained.
+ */
+
+void Rnpp_pool :: work (const bool pinned, const dimension_t node)
+{
+    if (pinned)
+        kernel_numa_pin (node);
+
+    for (;;)
+    {
+        unique_lock <mutex> guard (this -> lock);
+
+        this -> filled.wait (guard, [&] (void)
+                                    {
+                                        return this -> stopping
+                                            || ! this -> queue.empty ();
+                                    });
+
+        if (this -> queue.empty ())
+            return;
+
+        const function <void (void)> task = move (this -> queue.front ());
+
+        this -> queue.pop_front ();
+        guard.unlock ();
+        this -> space.notify_one ();
+        task ();
+    };
+}
+
+/******************************************************************************/
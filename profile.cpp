@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The instrumentation of the operations.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        profile.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the counters of the instrumentation and their export.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <ostream>
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   The counters of the instrumentation.
+ */
+
+atomic <uint64_t> kernel_profile [Rnpp_operations][0x4];
+
+
+
+/**
+ * \brief   The names of the operations in the JSON export.
+ */
+
+static const char * const profile_names [Rnpp_operations] =
+{
+    "addition",
+    "construction",
+    "copy",
+    "distance",
+    "division",
+    "inner",
+    "multiplication",
+    "normalise",
+    "set_components",
+    "subtraction"
+};
+
+
+
+/**
+ * \brief   Take a snapshot of the counters of all operations.
+ * \return  The counters, indexed by `Rnpp_operation_t`.
+ *
+ * Each counter is read on its own, such that operations running concurrently
+ * to the snapshot may be reflected partially.
+ */
+
+vector <Rnpp_counters> Rnpp_profile (void)
+{
+    vector <Rnpp_counters> ret = vector <Rnpp_counters> (Rnpp_operations);
+
+    for (dimension_t i = 0x0; i < Rnpp_operations; i++)
+    {
+        ret[i].calls        = kernel_profile[i][0x0].load ();
+        ret[i].elements     = kernel_profile[i][0x1].load ();
+        ret[i].bytes        = kernel_profile[i][0x2].load ();
+        ret[i].nanoseconds  = kernel_profile[i][0x3].load ();
+    };
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Write the counters of all operations as JSON.
+ * \param   stream  The stream to write the counters to.
+ * \throws  invalid_argument    In case the stream cannot be written.
+ */
+
+void Rnpp_profile_json (ostream & stream)
+{
+    const vector <Rnpp_counters> counters = Rnpp_profile ();
+
+    stream << '{';
+
+    for (dimension_t i = 0x0; i < Rnpp_operations; i++)
+        stream << (i ? ", " : "")
+               << '"' << profile_names[i] << "\": {"
+               << "\"calls\": "         << counters[i].calls       << ", "
+               << "\"elements\": "      << counters[i].elements    << ", "
+               << "\"bytes\": "         << counters[i].bytes       << ", "
+               << "\"nanoseconds\": "   << counters[i].nanoseconds << '}';
+
+    stream << '}';
+
+    if (! stream)
+        RNPP_FAIL (invalid_argument, "The given stream cannot be written!");
+
+    return;
+}
+
+
+
+/**
+ * \brief   Reset the counters of all operations to zero.
+ */
+
+void Rnpp_profile_reset (void)
+{
+    for (dimension_t i = 0x0; i < Rnpp_operations; i++)
+        for (dimension_t j = 0x0; j < 0x4; j++)
+            kernel_profile[i][j].store (0x0);
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The projection class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        projection.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the projection class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <istream>
+#include <limits>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: numeric_limits;
+using std :: streamsize;
+
+
+
+/*
+ * Internal helpers.
+ */
+
+/**
+ * \brief   The tag identifying saved projections.
+ *
+ * These are the ASCII characters "RNPPROJ" as a little endian number.  A
+ * stream saved on a machine of the other byte order will be rejected.
+ */
+
+const uint64_t projection_magic = 0x4a4f5250504e52;
+
+
+
+/**
+ * \brief   Read raw bytes from a stream.
+ * \param   stream  The stream to read from.
+ * \param   data    The buffer to write the bytes to.
+ * \param   bytes   The number of bytes to read.
+ * \throws  invalid_argument    In case the stream ends too early.
+ */
+
+static void projection_read (istream &           stream,
+                             void *              data,
+                             const dimension_t   bytes)
+{
+    if (! stream.read (static_cast <char *> (data), streamsize (bytes)))
+        RNPP_FAIL (invalid_argument,
+                   "The given stream holds no valid projection!");
+
+    return;
+}
+
+
+
+/*
+ * Class methods.
+ */
+
+/**
+ * \brief   Construct a new Rnpp_projection object.
+ *
+ * This is the default constructor which will prepare an empty projection.
+ */
+
+Rnpp_projection :: Rnpp_projection (void)
+    : input (0x0), output (0x0), projection (Rnpp_gaussian)
+{
+    this -> set_threads (0x0);
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new random Rnpp_projection object.
+ * \param   input       The dimension of the vectors to transform.
+ * \param   output      The dimension of the transformed vectors.
+ * \param   projection  The distribution of the entries.
+ * \param   seed        The seed of the entries.
+ * \throws  invalid_argument    In case of an invalid argument.
+ *
+ * This constructor draws a random projection which preserves squared lengths
+ * in expectation.  `Rnpp_gaussian` entries are normally distributed with a
+ * variance of `1 / output`.  `Rnpp_sparse` entries are zero except for a
+ * fraction of `1 / sqrt (input)`, which are plus or minus
+ * `sqrt (sqrt (input) / output)` with equal probability, as proposed by Li,
+ * Hastie and Church.  Equal seeds will yield equal projections, regardless of
+ * the platform.
+ */
+
+Rnpp_projection :: Rnpp_projection (const dimension_t   input,
+                                    const dimension_t   output,
+                                    const projection_t  projection,
+                                    const uint64_t      seed)
+    : input (input), matrix (input * output), output (output),
+      projection (projection)
+{
+    if (! input || ! output)
+        RNPP_VIOLATION (invalid_argument,
+                        "A projection requires non-zero dimensions!");
+
+    if (projection == Rnpp_principal)
+        RNPP_VIOLATION (invalid_argument,
+                        "Principal components need to be fitted!");
+
+    const double    density = 1.0 / sqrt (double (input));
+    const double    scale   = projection == Rnpp_sparse
+                            ? sqrt (1.0 / (density * double (output)))
+                            : sqrt (1.0 / double (output));
+    uint64_t        state   = seed;
+
+    for (dimension_t i = 0x0; i < this -> matrix.size (); i++)
+        if (projection == Rnpp_gaussian)
+            this -> matrix[i] = float (scale * kernel_normal (state));
+        else
+        {
+            const double u = kernel_uniform (state);
+
+            if (u < density)
+                this -> matrix[i] = float (u < density / 0x2 ? scale : - scale);
+        };
+
+    this -> set_threads (0x0);
+    this -> prepare_biases ();
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp_projection object from a stream.
+ * \param   stream  The stream to read the projection from.
+ * \throws  invalid_argument    In case the stream holds no valid projection.
+ *
+ * This constructor restores a projection as written by `save ()`.
+ */
+
+Rnpp_projection :: Rnpp_projection (istream & stream)
+{
+    uint64_t header [0x6];
+
+    projection_read (stream, header, sizeof (header));
+
+    const uint64_t input        = header[0x2];
+    const uint64_t output       = header[0x3];
+    const uint64_t limit        = numeric_limits <dimension_t> :: max ()
+                                / sizeof (float);
+
+    if (header[0x0] != projection_magic || header[0x1] > Rnpp_sparse || ! input
+    ||  ! output || input > limit / output
+    ||  (header[0x4] && header[0x4] != input)
+    ||  (header[0x5] && header[0x5] != output))
+        RNPP_FAIL (invalid_argument,
+                   "The given stream holds no valid projection!");
+
+    this -> input       = dimension_t (input);
+    this -> matrix      = fvec_t (dimension_t (input * output));
+    this -> mean        = fvec_t (dimension_t (header[0x4]));
+    this -> output      = dimension_t (output);
+    this -> projection  = projection_t (header[0x1]);
+    this -> variances   = fvec_t (dimension_t (header[0x5]));
+
+    projection_read (stream, this -> matrix.data (),
+                     this -> matrix.size () * sizeof (float));
+    projection_read (stream, this -> mean.data (),
+                     this -> mean.size () * sizeof (float));
+    projection_read (stream, this -> variances.data (),
+                     this -> variances.size () * sizeof (float));
+
+    this -> set_threads (0x0);
+    this -> prepare_biases ();
+    return;
+}
+
+
+
+/**
+ * \brief   Destruct an Rnpp_projection object.
+ *
+ * This is the default destructor.
+ */
+
+Rnpp_projection :: ~Rnpp_projection (void)
+{
+    return;
+}
+
+/******************************************************************************/
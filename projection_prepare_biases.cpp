@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The projection class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        projection_prepare_biases.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the projection class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Prepare the offsets of the transformed vectors.
+ *
+ * Principal components are applied to centred vectors.  Instead of centring
+ * each vector, the projected mean is subtracted after the projection.  This
+ * method computes the projected mean once.
+ */
+
+void Rnpp_projection :: prepare_biases (void)
+{
+    const float * row = this -> matrix.data ();
+
+    this -> biases = fvec_t (this -> output);
+
+    if (this -> mean.empty ())
+        return;
+
+    for (dimension_t i = 0x0; i < this -> output; i++, row += this -> input)
+        this -> biases[i] = kernel_inner (row, this -> mean.data (),
+                                          this -> input);
+
+    return;
+}
+
+/******************************************************************************/
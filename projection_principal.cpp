@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The projection class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        projection_principal.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the projection class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: copy;
+using std :: fill;
+
+
+
+/*
+ * Class methods.
+ */
+
+/**
+ * \brief   Construct a new Rnpp_projection object by principal components.
+ * \param   batch   The batch to fit the projection to.
+ * \param   output  The number of principal components to keep.
+ * \param   seed    The seed of the initial subspace.
+ * \throws  invalid_argument    In case of an invalid argument.
+ *
+ * This constructor determines the mean and the covariance matrix of the given
+ * batch in a single parallel pass.  The eigenvectors of the largest eigenvalues
+ * are obtained by subspace iteration:  a random subspace of a few more
+ * dimensions than requested is multiplied by the covariance matrix and
+ * orthonormalised repeatedly until the Rayleigh-Ritz approximations of the
+ * eigenvalues settle.  This requires far less work than a full
+ * eigendecomposition of the covariance matrix.  The rows of the projection
+ * matrix are the principal components in descending order of their variances.
+ * Directions without any variance are projected to zero.
+ */
+
+Rnpp_projection :: Rnpp_projection (const Rnfpp_batch &    batch,
+                                    const dimension_t      output,
+                                    const uint64_t         seed)
+    : input (batch.get_dimension ()), output (output),
+      projection (Rnpp_principal)
+{
+    if (! output || output > this -> input)
+        RNPP_VIOLATION (invalid_argument,
+                        "There are too many or no components to keep!");
+
+    if (! batch.get_count ())
+        RNPP_VIOLATION (invalid_argument, "There is nothing to fit!");
+
+    this -> set_threads (0x0);
+
+    const dimension_t   d           = this -> input;
+    const dimension_t   n           = batch.get_count ();
+    const dimension_t   l           = min (d, output + 0x10);
+    Rnpp_statistics     statistics  = Rnpp_statistics (d, true);
+    uint64_t            state       = seed;
+
+    statistics.update (batch, this -> threads);
+
+    const vector <double> &         mean    = statistics.get_mean ();
+    const vector <double>           c       = statistics.covariance (n > 0x1);
+    vector <double>                 q       = vector <double> (l * d);
+    vector <double>                 z       = vector <double> (l * d);
+    vector <double>                 t       = vector <double> (l * l);
+    vector <double>                 values  = vector <double> (l);
+    vector <double>                 last    = vector <double> (l);
+    vector <double>                 w       = vector <double> (l * l);
+
+    this -> mean = fvec_t (mean.begin (), mean.end ());
+
+    for (dimension_t i = 0x0; i < l * d; i++)
+        q[i] = kernel_normal (state);
+
+    kernel_orthonormalise (q.data (), l, d);
+
+    for (dimension_t iteration = 0x0; iteration < 0x40; iteration++)
+    {
+        kernel_parallel_for (l, this -> threads, [&] (const dimension_t begin,
+                                                      const dimension_t end,
+                                                      const dimension_t)
+        {
+            kernel_inner_matrix (q.data () + begin * d, end - begin,
+                                 c.data (), d, d, z.data () + begin * d);
+        });
+
+        kernel_inner_matrix (q.data (), l, z.data (), l, d, t.data ());
+        kernel_eigen (t.data (), l, values.data (), w.data ());
+
+        double change = 0x0;
+
+        for (dimension_t i = 0x0; i < output; i++)
+            change = max (change, abs (values[i] - last[i]));
+
+        if (change <= 1e-12 * abs (values[0x0]))
+            break;
+
+        last = values;
+        fill (q.begin (), q.end (), 0.0);
+
+        for (dimension_t i = 0x0; i < l; i++)
+            for (dimension_t j = 0x0; j < l; j++)
+                kernel_axpy (w[i * l + j], z.data () + j * d,
+                             q.data () + i * d, d);
+
+        kernel_orthonormalise (q.data (), l, d);
+    };
+
+    copy (q.begin (), q.end (), z.begin ());
+    fill (q.begin (), q.end (), 0.0);
+
+    for (dimension_t i = 0x0; i < output; i++)
+        for (dimension_t j = 0x0; j < l; j++)
+            kernel_axpy (w[i * l + j], z.data () + j * d, q.data () + i * d, d);
+
+    this -> matrix      = fvec_t (q.begin (), q.begin () + output * d);
+    this -> variances   = fvec_t (values.begin (), values.begin () + output);
+
+    this -> prepare_biases ();
+    return;
+}
+
+/******************************************************************************/
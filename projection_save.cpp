@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The projection class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        projection_save.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the projection class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <ostream>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: streamsize;
+
+
+
+/**
+ * \brief   Save this projection to a stream.
+ * \param   stream  The stream to write the projection to.
+ * \throws  invalid_argument    In case the stream cannot be written.
+ *
+ * This method writes the kind, the dimensions, the matrix, the mean and the
+ * variances of this projection in the native byte order.  The stream should
+ * be opened in binary mode.  The projection can be restored by the respective
+ * constructor.
+ */
+
+void Rnpp_projection :: save (ostream & stream) const
+{
+    const uint64_t header [0x6] =
+    {
+        0x4a4f5250504e52,
+        uint64_t (this -> projection),
+        uint64_t (this -> input),
+        uint64_t (this -> output),
+        uint64_t (this -> mean.size ()),
+        uint64_t (this -> variances.size ())
+    };
+
+    stream.write (reinterpret_cast <const char *> (header), sizeof (header));
+    stream.write (reinterpret_cast <const char *> (this -> matrix.data ()),
+                  streamsize (this -> matrix.size () * sizeof (float)));
+    stream.write (reinterpret_cast <const char *> (this -> mean.data ()),
+                  streamsize (this -> mean.size () * sizeof (float)));
+    stream.write (reinterpret_cast <const char *> (this -> variances.data ()),
+                  streamsize (this -> variances.size () * sizeof (float)));
+
+    if (! stream)
+        RNPP_FAIL (invalid_argument, "The given stream cannot be written!");
+
+    return;
+}
+
+/******************************************************************************/
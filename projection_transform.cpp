@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The projection class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        projection_transform.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the projection class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Transform a vector.
+ * \param   rnpp    The vector to transform.
+ * \return  The transformed vector.
+ * \throws  invalid_argument    In case of a different dimension.
+ *
+ * This method projects the given vector onto the output dimension.
+ */
+
+Rnfpp Rnpp_projection :: transform (const Rnfpp & rnpp) const
+{
+    this -> assert_same_dimension (rnpp.get_dimension ());
+
+    const float *   x   = rnpp.get_components ().data ();
+    fvec_t          ret = fvec_t (this -> output);
+
+    for (dimension_t i = 0x0; i < this -> output; i++)
+        ret[i] = kernel_inner (this -> matrix.data () + i * this -> input, x,
+                               this -> input) - this -> biases[i];
+
+    return Rnfpp (ret);
+}
+
+
+
+/**
+ * \brief   Transform all rows of a batch.
+ * \param   batch   The batch to transform.
+ * \return  The transformed batch.
+ * \throws  invalid_argument    In case of a different dimension.
+ *
+ * This method projects all rows of the given batch in a single pass.  The rows
+ * are split into one contiguous range per thread and each range is multiplied
+ * panel by panel with the projection matrix by the matrix kernel.
+ */
+
+Rnfpp_batch Rnpp_projection :: transform (const Rnfpp_batch & batch) const
+{
+    this -> assert_same_dimension (batch.get_dimension ());
+
+    const dimension_t   count   = batch.get_count ();
+    const float *       x       = batch.get_components ().data ();
+    fvec_t              ret     = fvec_t (count * this -> output);
+
+    kernel_parallel_for (count, this -> threads, [&] (const dimension_t begin,
+                                                      const dimension_t end,
+                                                      const dimension_t)
+    {
+        for (dimension_t i = begin; i < end; i += kernel_panel)
+        {
+            const dimension_t   size    = min (end - i, kernel_panel);
+            float *             y       = ret.data () + i * this -> output;
+
+            kernel_inner_matrix (x + i * this -> input, size,
+                                 this -> matrix.data (), this -> output,
+                                 this -> input, y);
+
+            for (dimension_t r = 0x0; r < size; r++)
+                kernel_axpy (- 1.0f, this -> biases.data (),
+                             y + r * this -> output, this -> output);
+        };
+    });
+
+    return Rnfpp_batch (this -> output, ret);
+}
+
+/******************************************************************************/
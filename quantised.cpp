@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The quantised batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        quantised.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the quantised batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+#include <limits>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: lrint;
+using std :: max;
+using std :: min;
+using std :: numeric_limits;
+
+
+
+/**
+ * \brief   Construct a new Rnqpp_batch object.
+ *
+ * This is the default constructor which will prepare an empty batch.
+ */
+
+Rnqpp_batch :: Rnqpp_batch (void)
+    : count (0x0), dimension (0x0), quantisation (Rnpp_per_vector)
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnqpp_batch object by quantising a given batch.
+ * \param   batch           The batch to quantise.
+ * \param   quantisation    Whether to share the scales per dimension or row.
+ *
+ * This constructor determines the range of each dimension or row of the given
+ * batch and maps it linearly onto the codes [-127, 127].  The squared norms of
+ * the reconstructed rows are stored as well in order to approximate distances
+ * by inner products later on.
+ */
+
+Rnqpp_batch :: Rnqpp_batch (const Rnfpp_batch &  batch,
+                            const quantisation_t quantisation)
+    : codes (batch.get_count () * batch.get_dimension ()),
+      count (batch.get_count ()),
+      dimension (batch.get_dimension ()),
+      norms (batch.get_count ()),
+      quantisation (quantisation)
+{
+    const float *       x       = batch.get_components ().data ();
+    const bool          column  = quantisation == Rnpp_per_dimension;
+    const dimension_t   groups  = column ? this -> dimension : this -> count;
+    const float         huge    = numeric_limits <float> :: infinity ();
+    fvec_t              lower   = fvec_t (groups, huge);
+    fvec_t              upper   = fvec_t (groups, - huge);
+
+    for (dimension_t i = 0x0; i < this -> count; i++)
+        for (dimension_t j = 0x0; j < this -> dimension; j++)
+        {
+            const dimension_t   g = column ? j : i;
+            const float         v = x[i * this -> dimension + j];
+
+            lower[g] = min (lower[g], v);
+            upper[g] = max (upper[g], v);
+        };
+
+    this -> offsets = fvec_t (groups);
+    this -> scales  = fvec_t (groups);
+
+    for (dimension_t g = 0x0; g < groups; g++)
+        if (lower[g] <= upper[g])
+        {
+            this -> offsets[g]  = (upper[g] + lower[g]) / 0x2;
+            this -> scales[g]   = (upper[g] - lower[g]) / 0xfe;
+        };
+
+    for (dimension_t i = 0x0; i < this -> count; i++)
+    {
+        float norm = 0x0;
+
+        for (dimension_t j = 0x0; j < this -> dimension; j++)
+        {
+            const dimension_t   g       = column ? j : i;
+            const dimension_t   k       = i * this -> dimension + j;
+            const float         scale   = this -> scales[g];
+            float               code    = 0x0;
+
+            if (scale > 0x0)
+                code = min (max (float (lrint ((x[k] - this -> offsets[g])
+                                               / scale)), - 127.0f), 127.0f);
+
+            const float value = this -> offsets[g] + scale * code;
+
+            this -> codes[k] = int8_t (code);
+            norm += value * value;
+        };
+
+        this -> norms[i] = norm;
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Destruct an Rnqpp_batch object.
+ *
+ * This is the default destructor.
+ */
+
+Rnqpp_batch :: ~Rnqpp_batch (void)
+{
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The quantised batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        quantised_distance.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the quantised batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: max;
+
+
+
+/**
+ * \brief   The approximate distances of all rows to a query vector.
+ * \param   query   The vector to calculate the distances to.
+ * \return  The approximate distance of each row, in order.
+ * \throws  invalid_argument    In case the dimensions differ.
+ *
+ * This method approximates the Euclidean distance between each row and the
+ * query by `|x|^2 - 2 <x, q> + |q|^2`, using the stored squared norms of the
+ * reconstructed rows and the integer approximation of the inner products.
+ */
+
+fvec_t Rnqpp_batch :: distance (const Rnfpp & query) const
+{
+    const float *   q       = query.get_components ().data ();
+    const fvec_t    dot     = this -> inner (query);
+    const float     norm    = kernel_inner (q, q, this -> dimension);
+    fvec_t          ret     = fvec_t (this -> count);
+
+    for (dimension_t i = 0x0; i < this -> count; i++)
+        ret[i] = sqrt (max (this -> norms[i] - 0x2 * dot[i] + norm, 0.0f));
+
+    return ret;
+}
+
+/******************************************************************************/
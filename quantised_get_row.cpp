@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The quantised batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        quantised_get_row.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the quantised batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Get a row of this batch.
+ * \param   index   The index of the row to query.
+ * \return  The requested row, reconstructed from its codes.
+ * \throws  out_of_range    In case the given row does not exist.
+ *
+ * This method reconstructs the requested row as `offset + scale * code`.
+ */
+
+Rnfpp Rnqpp_batch :: get_row (const dimension_t index) const
+{
+    this -> assert_range (index);
+
+    const bool      column  = this -> quantisation == Rnpp_per_dimension;
+    const int8_t *  code    = this -> codes.data () + index * this -> dimension;
+    Rnfpp           ret     = Rnfpp (this -> dimension);
+    float *         row     = ret.get_components ().data ();
+
+    for (dimension_t j = 0x0; j < this -> dimension; j++)
+    {
+        const dimension_t g = column ? j : index;
+
+        row[j] = this -> offsets[g] + this -> scales[g] * code[j];
+    };
+
+    return ret;
+}
+
+/******************************************************************************/
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The quantised batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        quantised_inner.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the quantised batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   The approximate inner products of all rows with a query vector.
+ * \param   query   The vector to calculate the inner products with.
+ * \return  The approximate inner product of each row, in order.
+ * \throws  invalid_argument    In case the dimensions differ.
+ *
+ * This method quantises the query once and approximates the inner product of
+ * each row with it by an integer inner product of the codes.
+ */
+
+fvec_t Rnqpp_batch :: inner (const Rnfpp & query) const
+{
+    this -> assert_same_dimension (query);
+
+    vector <int8_t> code;
+    const bool      column  = this -> quantisation == Rnpp_per_dimension;
+    float           offset;
+    fvec_t          ret     = fvec_t (this -> count);
+    const int8_t *  row     = this -> codes.data ();
+    float           scale;
+
+    this -> quantise_query (query, code, scale, offset);
+
+    for (dimension_t i = 0x0; i < this -> count; i++, row += this -> dimension)
+    {
+        const float dot = scale * kernel_inner (row, code.data (),
+                                                this -> dimension);
+
+        ret[i] = column ? offset + dot
+                        : this -> offsets[i] * offset + this -> scales[i] * dot;
+    };
+
+    return ret;
+}
+
+/******************************************************************************/
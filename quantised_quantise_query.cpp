@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The quantised batch class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        quantised_quantise_query.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the quantised batch class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: lrint;
+using std :: max;
+
+
+
+/**
+ * \brief   Quantise a query for the integer kernels.
+ * \param   query   The query to quantise.
+ * \param   codes   The buffer to write the codes of the query to.
+ * \param   scale   The scale of the codes of the query.
+ * \param   offset  The part of the inner products not covered by the codes.
+ *
+ * This method maps the query symmetrically onto the codes [-127, 127] such
+ * that the inner product of a row with the query is approximated by
+ *
+ *      offset + scale * (codes of the row) * (codes of the query)
+ *
+ * for the per dimension quantisation.  The query is scaled per dimension
+ * beforehand such that the integer inner product covers the scales of the
+ * batch.  For the per vector quantisation, `offset` is the sum of the
+ * components of the query which needs to be weighted by the offset of the row
+ * and the result of the integer kernel needs to be scaled by the scale of the
+ * row.
+ */
+
+void Rnqpp_batch :: quantise_query (const Rnfpp &       query,
+                                    vector <int8_t> &   codes,
+                                    float &             scale,
+                                    float &             offset) const
+{
+    const bool      column  = this -> quantisation == Rnpp_per_dimension;
+    const float *   q       = query.get_components ().data ();
+    fvec_t          weights = fvec_t (this -> dimension);
+    float           maximum = 0x0;
+
+    offset = 0x0;
+
+    for (dimension_t j = 0x0; j < this -> dimension; j++)
+    {
+        weights[j]  = column ? q[j] * this -> scales[j] : q[j];
+        offset     += column ? q[j] * this -> offsets[j] : q[j];
+        maximum     = max (maximum, abs (weights[j]));
+    };
+
+    scale = maximum / 127.0f;
+    codes = vector <int8_t> (this -> dimension);
+
+    if (maximum > 0x0)
+        for (dimension_t j = 0x0; j < this -> dimension; j++)
+            codes[j] = int8_t (lrint (weights[j] / scale));
+
+    return;
+}
+
+/******************************************************************************/
@@ -49,7 +49,8 @@
  * other one.
  */
 
-bool Rnfpp :: same_dimension (const fvec_t & other) const noexcept
+template <typename T>
+bool Rnpp <T> :: same_dimension (const vec_t & other) const noexcept
 {
     return this -> get_dimension () == other.size ();
 }
@@ -65,9 +66,35 @@ bool Rnfpp :: same_dimension (const fvec_t & other) const noexcept
  * other one.
  */
 
-bool Rnfpp :: same_dimension (const Rnfpp & other) const noexcept
+template <typename T>
+template <typename U, typename>
+bool Rnpp <T> :: same_dimension (const Rnpp <U> & other) const noexcept
 {
     return this -> get_dimension () == other.get_dimension ();
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template bool Rnbpp :: same_dimension (const Rnbpp :: vec_t &) const noexcept;
+template bool Rnbpp :: same_dimension (const Rnbpp &) const noexcept;
+template bool Rnbpp :: same_dimension (const Rnfpp &) const noexcept;
+template bool Rnbpp :: same_dimension (const Rnhpp &) const noexcept;
+
+template bool Rndpp :: same_dimension (const Rndpp :: vec_t &) const noexcept;
+template bool Rndpp :: same_dimension (const Rndpp &) const noexcept;
+
+template bool Rnfpp :: same_dimension (const Rnfpp :: vec_t &) const noexcept;
+template bool Rnfpp :: same_dimension (const Rnbpp &) const noexcept;
+template bool Rnfpp :: same_dimension (const Rnfpp &) const noexcept;
+template bool Rnfpp :: same_dimension (const Rnhpp &) const noexcept;
+
+template bool Rnhpp :: same_dimension (const Rnhpp :: vec_t &) const noexcept;
+template bool Rnhpp :: same_dimension (const Rnbpp &) const noexcept;
+template bool Rnhpp :: same_dimension (const Rnfpp &) const noexcept;
+template bool Rnhpp :: same_dimension (const Rnhpp &) const noexcept;
+
 /******************************************************************************/
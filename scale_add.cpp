@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The Rnfpp vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        scale_add.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the Rnfpp vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Scale this vector and add another one.
+ * \param   alpha   The factor of this vector.
+ * \param   x       The other vector.
+ * \return  This vector.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method computes `this = alpha * this + x` in place, as required by
+ * momentum updates, for instance.
+ */
+
+template <typename T>
+Rnpp <T> & Rnpp <T> :: scale_add (const scalar_t alpha, const Rnpp <T> & x)
+{
+    return this -> axpby (scalar_t (0x1), x, alpha);
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp & Rnbpp :: scale_add (const float, const Rnbpp &);
+
+template Rndpp & Rndpp :: scale_add (const double, const Rndpp &);
+
+template Rnfpp & Rnfpp :: scale_add (const float, const Rnfpp &);
+
+template Rnhpp & Rnhpp :: scale_add (const float, const Rnhpp &);
+
+/******************************************************************************/
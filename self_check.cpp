@@ -0,0 +1,1253 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The self-check of the kernels.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        self_check.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements scalar reference versions of the kernels and compares
+ * the optimised kernels against them.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: exp;
+using std :: function;
+using std :: isinf;
+using std :: isnan;
+using std :: ldexp;
+using std :: memcmp;
+using std :: nextafter;
+using std :: numeric_limits;
+
+
+
+/*
+ * Internal helpers.
+ */
+
+/**
+ * \brief   The dimensions beyond the short ones to check the kernels with.
+ *
+ * All dimensions up to `reference_short` are checked in order to exercise
+ * each combination of vectorised loops and scalar tails.  These ones cross the
+ * boundaries of the unrolled loops and of the blocks of the mixed-precision
+ * kernels.
+ */
+
+static const dimension_t reference_long [] =
+    {0x3f, 0x40, 0x41, 0xff, 0x100, 0x101, 0x3ff};
+
+
+
+/**
+ * \brief   The number of consecutive dimensions to check the kernels with.
+ */
+
+static const dimension_t reference_short = 0x22;
+
+
+
+/**
+ * \brief   The number of misalignments to check the kernels with.
+ *
+ * The operands are placed at each offset of up to this many components from
+ * the start of their buffers.
+ */
+
+static const dimension_t reference_offsets = 0x4;
+
+
+
+/**
+ * \brief   Fill a buffer with random operands.
+ * \param   x       The buffer to fill.
+ * \param   count   The number of components.
+ * \param   state   The state of the generator.
+ * \param   special Whether to include infinities, NaN and the largest numbers.
+ *
+ * Most components are normally distributed and scaled by a random power of two
+ * between `2 ^ -8` and `2 ^ 8`.  Every sixteenth component on average is a
+ * special value instead:  a signed zero, a subnormal number or the smallest
+ * normal one, and, if requested, the largest finite numbers, the infinities or
+ * NaN.
+ */
+
+template <typename T>
+static void reference_fill (T *                 x,
+                            const dimension_t   count,
+                            uint64_t &          state,
+                            const bool          special) noexcept
+{
+    typedef numeric_limits <T> limits;
+
+    const T values [] = { T (0x0), - T (0x0), limits :: denorm_min ()
+                        , - limits :: denorm_min (), limits :: min ()
+                        , limits :: max (), - limits :: max ()
+                        , limits :: infinity (), - limits :: infinity ()
+                        , limits :: quiet_NaN ()
+                        };
+
+    for (dimension_t i = 0x0; i < count; i++)
+    {
+        const uint64_t r = kernel_random (state);
+
+        if (! (r & 0xf))
+            x[i] = values[(r >> 0x8) % (special ? 0xa : 0x5)];
+        else
+            x[i] = T (ldexp (kernel_normal (state),
+                             int ((r >> 0x8) % 0x11) - 0x8));
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Compare a result with its reference bit by bit.
+ * \param   value       The result of the optimised kernel.
+ * \param   reference   The result of the reference kernel.
+ * \return  Whether both are identical or both are NaN.
+ */
+
+template <typename T>
+static bool reference_same (const T value, const T reference) noexcept
+{
+    return (isnan (value) && isnan (reference))
+        || ! memcmp (& value, & reference, sizeof (T));
+}
+
+
+
+/**
+ * \brief   Compare a result with its reference within an error bound.
+ * \param   value       The result of the optimised kernel.
+ * \param   reference   The exact result, or an approximation of it in extended
+ *                      precision.
+ * \param   bound       The largest admissible absolute error.
+ * \return  Whether the result is within the bound.
+ *
+ * If the reference rounds to an infinity or is NaN, the result needs to be the
+ * very same infinity or NaN, respectively.
+ */
+
+template <typename T>
+static bool reference_close (const T            value,
+                             const long double  reference,
+                             const long double  bound) noexcept
+{
+    if (isnan (reference))
+        return isnan (value);
+    else if (isinf (T (reference)))
+        return value == T (reference);
+
+    return abs ((long double) (value) - reference) <= bound;
+}
+
+
+
+/**
+ * \brief   The admissible error of a sum.
+ * \param   count       The number of terms.
+ * \param   magnitude   The sum of the magnitudes of all terms.
+ * \return  The largest admissible absolute error.
+ *
+ * Each term and each partial sum is rounded at most once, in any order of
+ * summation.  Terms below the range of normal numbers may be lost entirely.
+ */
+
+template <typename T>
+static long double reference_bound (const dimension_t   count,
+                                    const long double   magnitude) noexcept
+{
+    typedef numeric_limits <T> limits;
+
+    return (count + 0x2) * limits :: epsilon () * magnitude
+         + (count + 0x1) * limits :: min ();
+}
+
+
+
+/*
+ * Reference kernels.
+ */
+
+/**
+ * \brief   The reference version of `kernel_axpby`.
+ * \param   alpha   The factor of `x`.
+ * \param   x       The vector to scale.
+ * \param   beta    The factor of `y`.
+ * \param   y       The vector to combine with.
+ * \param   i       The component to compute.
+ * \return  The updated component in extended precision.
+ */
+
+template <typename T>
+static long double reference_axpby (const T             alpha,
+                                    const T *           x,
+                                    const T             beta,
+                                    const T *           y,
+                                    const dimension_t   i) noexcept
+{
+    return (long double) (alpha) * x[i] + (long double) (beta) * y[i];
+}
+
+
+
+/**
+ * \brief   The reference version of `kernel_binary`.
+ * \param   op  The operation to perform.
+ * \param   a   The first operand.
+ * \param   b   The second operand.
+ * \return  The result of the operation.
+ *
+ * The minimum and the maximum follow `std :: min` and `std :: max`.
+ */
+
+template <typename T>
+static T reference_binary (const kernel_op_t op, const T a, const T b) noexcept
+{
+    switch (op)
+    {
+        case kernel_divide:     return a / b;
+        case kernel_maximum:    return a < b ? b : a;
+        case kernel_minimum:    return b < a ? b : a;
+        case kernel_multiply:   return a * b;
+        default:                return a;
+    };
+}
+
+
+
+/**
+ * \brief   The reference version of `kernel_clamp`.
+ * \param   lower   The lower bound.
+ * \param   upper   The upper bound.
+ * \param   x       The operand.
+ * \return  The clamped operand.
+ */
+
+template <typename T>
+static T reference_clamp (const T lower, const T upper, const T x) noexcept
+{
+    return x < lower ? lower : upper < x ? upper : x;
+}
+
+
+
+/**
+ * \brief   The reference version of `kernel_distance_squared`.
+ * \param   a       The first vector.
+ * \param   b       The second vector.
+ * \param   count   The number of components.
+ * \param   bound   The variable to store the admissible error in.
+ * \return  The squared distance in extended precision.
+ */
+
+template <typename T>
+static long double reference_distance_squared (const T *           a,
+                                               const T *           b,
+                                               const dimension_t   count,
+                                               long double &       bound)
+    noexcept
+{
+    long double magnitude   = 0.0;
+    long double ret         = 0.0;
+
+    for (dimension_t i = 0x0; i < count; i++)
+    {
+        const long double d = (long double) (a[i]) - b[i];
+        const long double m = abs ((long double) (a[i])) + abs (b[i]);
+
+        magnitude   += m * m;
+        ret         += d * d;
+    };
+
+    bound = reference_bound <T> (count, magnitude);
+    return ret;
+}
+
+
+
+/**
+ * \brief   The reference version of `kernel_inner`.
+ * \param   a       The first vector.
+ * \param   b       The second vector.
+ * \param   count   The number of components.
+ * \param   bound   The variable to store the admissible error in.
+ * \return  The inner product in extended precision.
+ */
+
+template <typename T>
+static long double reference_inner (const T *           a,
+                                    const T *           b,
+                                    const dimension_t   count,
+                                    long double &       bound) noexcept
+{
+    long double magnitude   = 0.0;
+    long double ret         = 0.0;
+
+    for (dimension_t i = 0x0; i < count; i++)
+    {
+        const long double p = (long double) (a[i]) * b[i];
+
+        magnitude   += abs (p);
+        ret         += p;
+    };
+
+    bound = reference_bound <T> (count, magnitude);
+    return ret;
+}
+
+
+
+/**
+ * \brief   The reference version of `kernel_unary`.
+ * \param   op  The operation to perform.
+ * \param   x   The operand.
+ * \return  The result of the operation.
+ *
+ * The absolute value and the square root are exactly rounded to the type of
+ * the operand; only the exponential function is evaluated in extended
+ * precision.
+ */
+
+template <typename T>
+static long double reference_unary (const kernel_op_t op, const T x) noexcept
+{
+    switch (op)
+    {
+        case kernel_absolute:       return abs (x);
+        case kernel_exponential:    return exp ((long double) (x));
+        case kernel_square_root:    return sqrt (x);
+        default:                    return x;
+    };
+}
+
+
+
+/**
+ * \brief   The unsigned integer of the width of a floating point type.
+ */
+
+template <typename T>
+struct reference_bits;
+
+template <>
+struct reference_bits <double>
+{
+    typedef uint64_t type;
+};
+
+template <>
+struct reference_bits <float>
+{
+    typedef uint32_t type;
+};
+
+
+
+/**
+ * \brief   Compare two components approximately.
+ * \param   a           The first component.
+ * \param   b           The second component.
+ * \param   absolute    The absolute tolerance.
+ * \param   relative    The tolerance relative to the larger magnitude.
+ * \param   ulps        The tolerance in units in the last place.
+ * \return  Whether the components are close to each other.
+ *
+ * Two components are close if their difference is finite and within the larger
+ * tolerance or if they are at most `ulps` representable numbers apart, counted
+ * across zero for components of different signs.  Distances which exceed the
+ * signed integers of the width of the type are too far.  NaN is never close.
+ */
+
+template <typename T>
+static bool reference_approx (const T           a,
+                              const T           b,
+                              const T           absolute,
+                              const T           relative,
+                              const uint32_t    ulps) noexcept
+{
+    typedef typename reference_bits <T> :: type bits_t;
+
+    const bits_t    sign    = bits_t (0x1) << (sizeof (bits_t) * 0x8 - 0x1);
+    const T         d       = abs (a - b);
+    bits_t          x;
+    bits_t          y;
+
+    if (isnan (a) || isnan (b))
+        return false;
+
+    if (! isinf (d) && d <= max (absolute, relative * max (abs (a), abs (b))))
+        return true;
+
+    memcpy (& x, & a, sizeof (x));
+    memcpy (& y, & b, sizeof (y));
+
+    const uint64_t  mx      = x & ~sign;
+    const uint64_t  my      = y & ~sign;
+    const uint64_t  u       = (x ^ y) & sign ? mx + my
+                                             : (mx > my ? mx - my : my - mx);
+
+    return u <= min (uint64_t (ulps), uint64_t (sign - 0x1));
+}
+
+
+
+/**
+ * \brief   Canonicalise a component.
+ * \param   x   The component to canonicalise.
+ * \return  Positive zero for a signed zero, the quiet NaN for any NaN and the
+ *          component itself otherwise.
+ */
+
+template <typename T>
+static T reference_canonical (const T x) noexcept
+{
+    if (isnan (x))
+        return numeric_limits <T> :: quiet_NaN ();
+    else if (x == T (0x0))
+        return T (0x0);
+
+    return x;
+}
+
+
+
+/**
+ * \brief   Mix the bits of a 64 bit integer like MurmurHash3 finalises.
+ * \param   x   The integer to mix.
+ * \return  The mixed integer.
+ */
+
+static uint64_t reference_mix (uint64_t x) noexcept
+{
+    x = (x ^ (x >> 0x21)) * 0xff51afd7ed558ccd;
+    x = (x ^ (x >> 0x21)) * 0xc4ceb9fe1a85ec53;
+
+    return x ^ (x >> 0x21);
+}
+
+
+
+/**
+ * \brief   The content hash of raw memory, one stripe and lane at a time.
+ * \param   data    The memory to hash.
+ * \param   bytes   The number of bytes.
+ * \param   seed    The seed to start with.
+ * \return  The hash.
+ *
+ * Each stripe of 32 bytes is read as four little endian 64 bit lanes; the last
+ * stripe is padded with zeros.  Each lane is added to its neighbour and the
+ * product of the halves of the lane mixed with its key is added to its own
+ * accumulator.  The keys advance by a fixed step per stripe.  The length and
+ * the accumulators are mixed into the hash in the end.
+ */
+
+static uint64_t reference_hash (const unsigned char *   data,
+                                const dimension_t       bytes,
+                                const uint64_t          seed) noexcept
+{
+    const uint64_t  keys [kernel_hash_lanes] =
+    {
+        0x9e3779b185ebca87, 0xc2b2ae3d27d4eb4f, 0x165667b19e3779f9,
+        0x85ebca77c2b2ae63
+    };
+    const uint64_t  step    = 0x27d4eb2f165667c5;
+    uint64_t        acc [kernel_hash_lanes];
+
+    for (dimension_t j = 0x0; j < kernel_hash_lanes; j++)
+        acc[j] = reference_mix (seed + j) ^ keys[j];
+
+    for (dimension_t s = 0x0; s * kernel_hash_stripe < bytes; s++)
+    {
+        const dimension_t   begin   = s * kernel_hash_stripe;
+        unsigned char       stripe [kernel_hash_stripe] = { 0x0 };
+
+        memcpy (stripe, data + begin, min (bytes - begin, kernel_hash_stripe));
+
+        for (dimension_t j = 0x0; j < kernel_hash_lanes; j++)
+        {
+            uint64_t v = 0x0;
+
+            for (dimension_t k = 0x0; k < 0x8; k++)
+                v |= uint64_t (stripe[j * 0x8 + k]) << (k * 0x8);
+
+            const uint64_t key = v ^ (keys[j] + step * s);
+
+            acc[j ^ 0x1]    += v;
+            acc[j]          += (key & 0xffffffff) * (key >> 0x20);
+        };
+    };
+
+    uint64_t ret = reference_mix (bytes * step);
+
+    for (dimension_t j = 0x0; j < kernel_hash_lanes; j++)
+        ret = reference_mix (ret ^ acc[j]) * keys[j];
+
+    return reference_mix (ret);
+}
+
+
+
+/**
+ * \brief   The content hash of canonicalised components.
+ * \param   in      The components to hash.
+ * \param   count   The number of components.
+ * \param   seed    The seed to start with.
+ * \return  The hash of the canonical components of the scalar type.
+ */
+
+template <typename T>
+static uint64_t reference_hash_canonical (const T *         in,
+                                          const dimension_t count,
+                                          const uint64_t    seed)
+{
+    typedef typename Rnpp_traits <T> :: scalar_t scalar_t;
+
+    vector <scalar_t> canonical = vector <scalar_t> (count);
+
+    for (dimension_t i = 0x0; i < count; i++)
+        canonical[i] = reference_canonical (scalar_t (in[i]));
+
+    return reference_hash ((const unsigned char *) canonical.data (),
+                           count * sizeof (scalar_t), seed);
+}
+
+
+
+/*
+ * Checks.
+ */
+
+/**
+ * \brief   Check the kernels of both floating point types.
+ * \param   count   The number of components.
+ * \param   offset  The misalignment of the operands.
+ * \param   state   The state of the generator.
+ * \return  The number of failed comparisons.
+ *
+ * The element-wise kernels are checked with all special values and need to
+ * agree with their references bit by bit, apart from the approximated
+ * exponential function.  The linear combinations and the reductions are
+ * checked with finite operands within the error bounds of their rounding.
+ */
+
+template <typename T>
+static dimension_t reference_check (const dimension_t   count,
+                                    const dimension_t   offset,
+                                    uint64_t &          state)
+{
+    typedef numeric_limits <T> limits;
+
+    const kernel_op_t   binary []   = { kernel_divide, kernel_maximum
+                                      , kernel_minimum, kernel_multiply
+                                      };
+    const kernel_op_t   unary []    = { kernel_absolute, kernel_exponential
+                                      , kernel_square_root
+                                      };
+    const T             alpha       = T (kernel_normal (state));
+    const T             beta        = T (kernel_normal (state));
+    const T             lower       = T (kernel_normal (state));
+    const T             upper       = lower + abs (T (kernel_normal (state)));
+    const T             eps         = limits :: epsilon ();
+    vector <T>          buffer_a    = vector <T> (count + offset);
+    vector <T>          buffer_b    = vector <T> (count + offset);
+    vector <T>          buffer_y    = vector <T> (count + offset);
+    T *                 a           = buffer_a.data () + offset;
+    T *                 b           = buffer_b.data () + offset;
+    T *                 y           = buffer_y.data () + offset;
+    long double         bound       = 0.0;
+    dimension_t         ret         = 0x0;
+
+    reference_fill (a, count, state, true);
+    reference_fill (b, count, state, true);
+
+    for (const kernel_op_t op : binary)
+    {
+        kernel_binary (op, a, b, y, count);
+
+        for (dimension_t i = 0x0; i < count; i++)
+            ret += ! reference_same (y[i], reference_binary (op, a[i], b[i]));
+    };
+
+    for (const kernel_op_t op : unary)
+    {
+        kernel_unary (op, a, y, count);
+
+        for (dimension_t i = 0x0; i < count; i++)
+        {
+            const long double r = reference_unary (op, a[i]);
+
+            ret += op == kernel_exponential
+                 ? ! reference_close (y[i], r, 0x4 * eps * abs (r)
+                                               + limits :: min ())
+                 : ! reference_same (y[i], T (r));
+        };
+    };
+
+    kernel_clamp (lower, upper, a, y, count);
+
+    for (dimension_t i = 0x0; i < count; i++)
+        ret += ! reference_same (y[i], reference_clamp (lower, upper, a[i]));
+
+    memcpy (y, b, count * sizeof (T));
+    kernel_scale (alpha, y, count);
+
+    for (dimension_t i = 0x0; i < count; i++)
+        ret += ! reference_same (y[i], T (alpha * b[i]));
+
+    reference_fill (a, count, state, false);
+    reference_fill (b, count, state, false);
+
+    memcpy (y, b, count * sizeof (T));
+    kernel_axpby (alpha, a, beta, y, count);
+
+    for (dimension_t i = 0x0; i < count; i++)
+        ret += ! reference_close (y[i], reference_axpby (alpha, a, beta, b, i),
+                                  0x2 * eps * (abs (alpha * a[i])
+                                               + abs (beta * b[i]))
+                                  + limits :: min ());
+
+    memcpy (y, b, count * sizeof (T));
+    kernel_axpy (alpha, a, y, count);
+
+    for (dimension_t i = 0x0; i < count; i++)
+        ret += ! reference_close (y[i], reference_axpby (alpha, a, T (0x1), b,
+                                                         i),
+                                  0x2 * eps * (abs (alpha * a[i]) + abs (b[i]))
+                                  + limits :: min ());
+
+    long double r = reference_inner (a, b, count, bound);
+
+    ret += ! reference_close (kernel_inner (a, b, count), r, bound);
+
+    r = reference_distance_squared (a, b, count, bound);
+
+    ret += ! reference_close (kernel_distance_squared (a, b, count), r, bound);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Check the inner products of two matrices.
+ * \param   count   The number of components per row.
+ * \param   offset  The misalignment of the operands.
+ * \param   state   The state of the generator.
+ * \return  The number of failed comparisons.
+ */
+
+template <typename T>
+static dimension_t reference_check_matrix (const dimension_t    count,
+                                           const dimension_t    offset,
+                                           uint64_t &           state)
+{
+    const dimension_t   rows_a      = 0x1 + kernel_random (state) % 0x5;
+    const dimension_t   rows_b      = 0x1 + kernel_random (state) % 0x7;
+    vector <T>          buffer_a    = vector <T> (rows_a * count + offset);
+    vector <T>          buffer_b    = vector <T> (rows_b * count + offset);
+    vector <T>          out         = vector <T> (rows_a * rows_b);
+    const T *           a           = buffer_a.data () + offset;
+    const T *           b           = buffer_b.data () + offset;
+    long double         bound       = 0.0;
+    dimension_t         ret         = 0x0;
+
+    reference_fill (buffer_a.data () + offset, rows_a * count, state, false);
+    reference_fill (buffer_b.data () + offset, rows_b * count, state, false);
+    kernel_inner_matrix (a, rows_a, b, rows_b, count, out.data ());
+
+    for (dimension_t i = 0x0; i < rows_a; i++)
+        for (dimension_t j = 0x0; j < rows_b; j++)
+        {
+            const long double r = reference_inner (a + i * count,
+                                                   b + j * count, count,
+                                                   bound);
+
+            ret += ! reference_close (out[i * rows_b + j], r, bound);
+        };
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Check the conversions between the storage types.
+ * \param   count   The number of components.
+ * \param   state   The state of the generator.
+ * \return  The number of failed comparisons.
+ *
+ * The vectorised conversions need to agree bit by bit with the scalar ones of
+ * `half_t` and `bfloat16_t`, for all special values and, when widening, for
+ * arbitrary bit patterns.
+ */
+
+static dimension_t reference_check_convert (const dimension_t   count,
+                                            uint64_t &          state)
+{
+    fvec_t                  x       = fvec_t (count);
+    fvec_t                  y       = fvec_t (count);
+    vector <bfloat16_t>     b       = vector <bfloat16_t> (count);
+    vector <half_t>         h       = vector <half_t> (count);
+    dimension_t             ret     = 0x0;
+
+    reference_fill (x.data (), count, state, true);
+    kernel_narrow (x.data (), b.data (), count);
+    kernel_narrow (x.data (), h.data (), count);
+
+    for (dimension_t i = 0x0; i < count; i++)
+    {
+        ret += ! reference_same (float (b[i]), float (bfloat16_t (x[i])));
+        ret += ! reference_same (float (h[i]), float (half_t (x[i])));
+    };
+
+    for (dimension_t i = 0x0; i < count; i++)
+    {
+        const uint64_t r = kernel_random (state);
+
+        b[i].set_bits (uint16_t (r));
+        h[i].set_bits (uint16_t (r >> 0x10));
+    };
+
+    kernel_widen (b.data (), y.data (), count);
+
+    for (dimension_t i = 0x0; i < count; i++)
+        ret += ! reference_same (y[i], float (b[i]));
+
+    kernel_widen (h.data (), y.data (), count);
+
+    for (dimension_t i = 0x0; i < count; i++)
+        ret += ! reference_same (y[i], float (h[i]));
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Check the inner product of quantised vectors.
+ * \param   count   The number of components.
+ * \param   offset  The misalignment of the operands.
+ * \param   state   The state of the generator.
+ * \return  The number of failed comparisons.
+ *
+ * The components are drawn from [-127, 127], the range of quantised vectors.
+ */
+
+static dimension_t reference_check_quantised (const dimension_t count,
+                                              const dimension_t offset,
+                                              uint64_t &        state)
+{
+    vector <int8_t>     buffer_a    = vector <int8_t> (count + offset);
+    vector <int8_t>     buffer_b    = vector <int8_t> (count + offset);
+    const int8_t *      a           = buffer_a.data () + offset;
+    const int8_t *      b           = buffer_b.data () + offset;
+    int32_t             r           = 0x0;
+
+    for (dimension_t i = 0x0; i < count + offset; i++)
+    {
+        const uint64_t u = kernel_random (state);
+
+        buffer_a[i] = int8_t (int32_t (u % 0xff) - 0x7f);
+        buffer_b[i] = int8_t (int32_t ((u >> 0x8) % 0xff) - 0x7f);
+    };
+
+    for (dimension_t i = 0x0; i < count; i++)
+        r += int32_t (a[i]) * int32_t (b[i]);
+
+    return kernel_inner (a, b, count) != r;
+}
+
+
+
+/**
+ * \brief   Check the sparse kernels.
+ * \param   count   The dimension of the vectors.
+ * \param   state   The state of the generator.
+ * \return  The number of failed comparisons.
+ *
+ * Two random vectors are thinned out to sparse ones and combined with each
+ * other and with a dense one.  The references compute the very same results
+ * from the dense forms of the sparse vectors.
+ */
+
+static dimension_t reference_check_sparse (const dimension_t    count,
+                                           uint64_t &           state)
+{
+    const float         alpha   = float (kernel_normal (state));
+    fvec_t              a       = fvec_t (count);
+    fvec_t              b       = fvec_t (count);
+    fvec_t              y       = fvec_t (count);
+    fvec_t              z       = fvec_t (count);
+    vector <uint32_t>   ia;
+    vector <uint32_t>   ib;
+    fvec_t              va;
+    fvec_t              vb;
+    long double         bound   = 0.0;
+    long double         r       = 0.0;
+    dimension_t         ret     = 0x0;
+
+    reference_fill (a.data (), count, state, false);
+    reference_fill (b.data (), count, state, false);
+    reference_fill (y.data (), count, state, false);
+
+    for (dimension_t i = 0x0; i < count; i++)
+    {
+        const uint64_t u = kernel_random (state);
+
+        if (u & 0x3 || a[i] == 0.0f)
+            a[i] = 0.0f;
+        else
+        {
+            ia.push_back (uint32_t (i));
+            va.push_back (a[i]);
+        };
+
+        if (u & 0x30 || b[i] == 0.0f)
+            b[i] = 0.0f;
+        else
+        {
+            ib.push_back (uint32_t (i));
+            vb.push_back (b[i]);
+        };
+    };
+
+    r = reference_inner (a.data (), y.data (), count, bound);
+    ret += ! reference_close (kernel_sparse_inner (ia.data (), va.data (),
+                                                   ia.size (), y.data ()),
+                              r, bound);
+
+    r = reference_inner (a.data (), b.data (), count, bound);
+    ret += ! reference_close (kernel_sparse_inner (ia.data (), va.data (),
+                                                   ia.size (), ib.data (),
+                                                   vb.data (), ib.size ()),
+                              r, bound);
+
+    r = reference_distance_squared (a.data (), y.data (), count, bound);
+    ret += ! reference_close (kernel_sparse_distance (ia.data (), va.data (),
+                                                      ia.size (), y.data (),
+                                                      count),
+                              r, bound);
+
+    r = reference_distance_squared (a.data (), b.data (), count, bound);
+    ret += ! reference_close (kernel_sparse_distance (ia.data (), va.data (),
+                                                      ia.size (), ib.data (),
+                                                      vb.data (), ib.size ()),
+                              r, bound);
+
+    z = y;
+    kernel_sparse_scatter (alpha, ia.data (), va.data (), ia.size (),
+                           z.data ());
+
+    for (dimension_t i = 0x0; i < count; i++)
+        ret += ! reference_close (z[i], reference_axpby (alpha, a.data (),
+                                                         1.0f, y.data (), i),
+                                  0x2 * numeric_limits <float> :: epsilon ()
+                                  * (abs (alpha * a[i]) + abs (y[i]))
+                                  + numeric_limits <float> :: min ());
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Check the exact and the approximate comparisons.
+ * \param   count   The number of components.
+ * \param   offset  The misalignment of the operands.
+ * \param   state   The state of the generator.
+ * \return  The number of failed comparisons.
+ *
+ * Components need to compare equal to themselves, even NaN.  Then, the NaN are
+ * replaced by zeros and the second operand equals the first one except for a
+ * single position, which is altered in turn at each position such that every
+ * block and the scalar tail need to exit early.  The alterations cover a
+ * flipped sign, which turns a signed zero into the other one, a step of a
+ * single unit in the last place, steps of exactly the tolerance and of one unit
+ * more, NaN and an infinity.  Since only the altered position differs, the
+ * references are derived from it and from the comparisons of the unaltered
+ * components with themselves.  For the long operands, each misalignment only
+ * alters the positions congruent to it modulo the number of misalignments such
+ * that the misalignments together alter all of them.
+ */
+
+template <typename T>
+static dimension_t reference_check_compare (const dimension_t   count,
+                                            const dimension_t   offset,
+                                            uint64_t &          state)
+{
+    typedef numeric_limits <T>                  limits;
+    typedef typename reference_bits <T> :: type bits_t;
+
+    const uint64_t      r           = kernel_random (state);
+    const uint32_t      ulps        = uint32_t (r & 0x7);
+    const T             absolute    = r & 0x8 ? limits :: min () : T (0x0);
+    const T             relative    = r & 0x10 ? limits :: epsilon ()
+                                               : T (0x0);
+    vector <T>          buffer_a    = vector <T> (count + offset);
+    vector <T>          buffer_b    = vector <T> (count + offset);
+    T *                 a           = buffer_a.data () + offset;
+    T *                 b           = buffer_b.data () + offset;
+    dimension_t         distant     = 0x0;
+    dimension_t         ret         = 0x0;
+
+    reference_fill (a, count, state, true);
+    memcpy (b, a, count * sizeof (T));
+
+    ret += ! kernel_equal (a, b, count);
+
+    for (dimension_t i = 0x0; i < count; i++)
+        if (isnan (a[i]))
+            a[i] = b[i] = T (0x0);
+
+    for (dimension_t i = 0x0; i < count; i++)
+        distant += ! reference_approx (a[i], a[i], absolute, relative, ulps);
+
+    for (dimension_t p = 0x0; p <= count; p++)
+    {
+        T variants [0x6];
+
+        if (p < count && count >= reference_short
+                      && p % reference_offsets != offset)
+            continue;
+
+        if (p < count)
+        {
+            bits_t bits;
+
+            memcpy (& bits, a + p, sizeof (bits));
+
+            const bits_t    near    = bits + ulps;
+            const bits_t    far     = bits + ulps + 0x1;
+
+            variants[0x0] = - a[p];
+            variants[0x1] = nextafter (a[p], limits :: infinity ());
+            memcpy (variants + 0x2, & near, sizeof (near));
+            memcpy (variants + 0x3, & far, sizeof (far));
+            variants[0x4] = limits :: quiet_NaN ();
+            variants[0x5] = limits :: infinity ();
+        };
+
+        for (dimension_t v = 0x0; v < (p < count ? 0x6 : 0x1); v++)
+        {
+            bool equal = true;
+            bool close = ! distant;
+
+            if (p < count)
+            {
+                const bool self = reference_approx (a[p], a[p], absolute,
+                                                    relative, ulps);
+
+                b[p]    = variants[v];
+                equal   = ! (a[p] < b[p] || a[p] > b[p]);
+                close   = distant == dimension_t (! self)
+                       && reference_approx (a[p], b[p], absolute, relative,
+                                            ulps);
+            };
+
+            ret += kernel_equal (a, b, count) != equal;
+            ret += kernel_approx_equal (a, b, count, absolute, relative, ulps)
+                != close;
+        };
+
+        if (p < count)
+            b[p] = a[p];
+    };
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Check the canonicalisation and the content hashes.
+ * \param   count   The number of components.
+ * \param   offset  The misalignment of the operands.
+ * \param   state   The state of the generator.
+ * \return  The number of failed comparisons.
+ *
+ * The canonical components need to match the reference bit by bit, also for
+ * NaN of any sign and payload.  The hashes of raw memory at any alignment and
+ * of the canonical components of each component type need to match the scalar
+ * reference bit by bit.
+ */
+
+static dimension_t reference_check_hash (const dimension_t  count,
+                                         const dimension_t  offset,
+                                         uint64_t &         state)
+{
+    const uint64_t          seed    = kernel_random (state);
+    const uint64_t          nan     = 0xfff4000000000000 | (seed >> 0x10);
+    const uint32_t          nanf    = 0xff800001 | uint32_t (seed >> 0x29);
+    vector <double>         d       = vector <double> (count + offset);
+    vector <double>         dc      = vector <double> (count);
+    fvec_t                  f       = fvec_t (count + offset);
+    fvec_t                  fc      = fvec_t (count);
+    vector <bfloat16_t>     b       = vector <bfloat16_t> (count);
+    vector <half_t>         h       = vector <half_t> (count);
+    vector <unsigned char>  raw     = vector <unsigned char> (count * 0x3
+                                                              + offset);
+    dimension_t             ret     = 0x0;
+
+    reference_fill (d.data () + offset, count, state, true);
+    reference_fill (f.data () + offset, count, state, true);
+
+    for (dimension_t i = offset; i < count + offset; i++)
+    {
+        const uint64_t r = kernel_random (state);
+
+        if (! (r & 0x1f))
+            memcpy (d.data () + i, & nan, sizeof (nan));
+
+        if (! (r & 0x3e0))
+            memcpy (f.data () + i, & nanf, sizeof (nanf));
+    };
+
+    kernel_canonicalise (d.data () + offset, dc.data (), count);
+    kernel_canonicalise (f.data () + offset, fc.data (), count);
+
+    for (dimension_t i = 0x0; i < count; i++)
+    {
+        const double    rd  = reference_canonical (d[i + offset]);
+        const float     rf  = reference_canonical (f[i + offset]);
+
+        ret += memcmp (& dc[i], & rd, sizeof (rd)) != 0x0;
+        ret += memcmp (& fc[i], & rf, sizeof (rf)) != 0x0;
+    };
+
+    for (dimension_t i = 0x0; i < raw.size (); i++)
+        raw[i] = (unsigned char) kernel_random (state);
+
+    ret += kernel_hash (raw.data () + offset, count * 0x3, seed)
+        != reference_hash (raw.data () + offset, count * 0x3, seed);
+
+    for (dimension_t i = 0x0; i < count; i++)
+    {
+        b[i] = bfloat16_t (f[i + offset]);
+        h[i] = half_t (f[i + offset]);
+    };
+
+    ret += kernel_hash_canonical (d.data () + offset, count, seed)
+        != reference_hash_canonical (d.data () + offset, count, seed);
+    ret += kernel_hash_canonical (f.data () + offset, count, seed)
+        != reference_hash_canonical (f.data () + offset, count, seed);
+    ret += kernel_hash_canonical (b.data (), count, seed)
+        != reference_hash_canonical (b.data (), count, seed);
+    ret += kernel_hash_canonical (h.data (), count, seed)
+        != reference_hash_canonical (h.data (), count, seed);
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Check the cosine of vectors of extreme magnitudes.
+ * \return  The number of failed comparisons.
+ *
+ * The squared norms of these vectors are still finite and normal, but their
+ * product is not.  The cosine of each vector with itself needs to be one,
+ * nevertheless.  Components of half precision cannot reach such magnitudes.
+ */
+
+template <typename T>
+static dimension_t reference_check_cosine (void)
+{
+    typedef typename Rnpp <T> :: scalar_t scalar_t;
+
+    const int       exponent    = numeric_limits <scalar_t> :: max_exponent
+                                * 0x3 / 0x8;
+    const scalar_t  bound       = 0x4 * numeric_limits <scalar_t> :: epsilon ();
+    dimension_t     ret         = 0x0;
+
+    for (const int e : {exponent, - exponent})
+    {
+        const T         components [] = {T (ldexp (scalar_t (0x3), e)),
+                                         T (ldexp (scalar_t (0x4), e))};
+        const Rnpp <T>  x = Rnpp <T> (components, 0x2);
+
+        ret += ! reference_close (x.cosine (x), 1.0l, bound);
+    };
+
+    return ret;
+}
+
+
+
+#if defined (__RNFPP_INSTRUMENT__)
+/**
+ * \brief   Check the operations documented to be free of allocations.
+ * \param   state   The state of the generator.
+ * \return  The number of operations which allocated.
+ *
+ * Each operation runs between two snapshots of the instrumentation.  Neither
+ * the bytes allocated nor the number of vectors constructed or copied may grow
+ * in between.  Since the counters are shared by all threads, the library should
+ * not be used concurrently meanwhile.  This check only sees the allocations of
+ * the vectors themselves; `bench/allocations.cpp` replaces the global
+ * allocation functions and hence catches any allocation.
+ */
+
+template <typename T>
+static dimension_t reference_check_allocations (uint64_t & state)
+{
+    typedef typename Rnpp <T> :: scalar_t scalar_t;
+
+    const dimension_t   count   = 0x41;
+    fvec_t              x       = fvec_t (count);
+    fvec_t              y       = fvec_t (count);
+    dimension_t         ret     = 0x0;
+
+    reference_fill (x.data (), count, state, false);
+    reference_fill (y.data (), count, state, false);
+    x[count - 0x1] = 1.0f;
+
+    Rnpp <T>                        a           = Rnpp <T> (Rnfpp (x));
+    const Rnpp <T>                  b           = Rnpp <T> (Rnfpp (y));
+    const vector <T>                v           = b.get_components ();
+    const scalar_t                  s           = scalar_t (0x2);
+    const function <void (void)>    operations [] =
+    {
+        [&] (void) { a += s; },
+        [&] (void) { a += v; },
+        [&] (void) { a += b; },
+        [&] (void) { a -= s; },
+        [&] (void) { a -= v; },
+        [&] (void) { a -= b; },
+        [&] (void) { a *= s; },
+        [&] (void) { a /= s; },
+        [&] (void) { a.inner (v); },
+        [&] (void) { a.inner (b); },
+        [&] (void) { a.distance (v); },
+        [&] (void) { a.distance (b); },
+        [&] (void) { a.norm (); },
+        [&] (void) { a == v; },
+        [&] (void) { a == b; },
+        [&] (void) { a.cosine (b); },
+        [&] (void) { a.normalise (); },
+        [&] (void) { a.affinise (); }
+    };
+
+    for (const function <void (void)> & operation : operations)
+    {
+        const vector <Rnpp_counters> before = Rnpp_profile ();
+
+        operation ();
+
+        const vector <Rnpp_counters> after = Rnpp_profile ();
+        bool allocated = after[Rnpp_construction].calls
+                      != before[Rnpp_construction].calls
+                      || after[Rnpp_copy].calls != before[Rnpp_copy].calls;
+
+        for (dimension_t i = 0x0; i < Rnpp_operations; i++)
+            allocated = allocated || after[i].bytes != before[i].bytes;
+
+        ret += allocated;
+    };
+
+    return ret;
+}
+#endif  // ! __RNFPP_INSTRUMENT__
+
+
+
+/*
+ * Self-check.
+ */
+
+/**
+ * \brief   Verify the optimised kernels against scalar reference versions.
+ * \param   seed    The seed of the random operands.
+ * \param   rounds  The number of rounds to run.
+ * \return  The number of failed comparisons.
+ *
+ * Each round checks every kernel with a vectorised path for all dimensions up
+ * to a few vector registers, a couple of larger ones and several misalignments
+ * of the operands.  The results need to agree with the references bit by bit
+ * where the operation is exactly rounded and otherwise within the error bound
+ * of the respective algorithm.  If the library is instrumented, the operations
+ * documented to be free of allocations are checked not to allocate, as well.
+ */
+
+dimension_t Rnpp_self_check (const uint64_t seed, const dimension_t rounds)
+{
+    const dimension_t   longs   = sizeof (reference_long)
+                                / sizeof (reference_long[0x0]);
+    uint64_t            state   = seed;
+    dimension_t         ret     = 0x0;
+
+#if defined (__RNFPP_INSTRUMENT__)
+    ret += reference_check_allocations <bfloat16_t> (state);
+    ret += reference_check_allocations <double>     (state);
+    ret += reference_check_allocations <float>      (state);
+    ret += reference_check_allocations <half_t>     (state);
+#endif  // ! __RNFPP_INSTRUMENT__
+
+    ret += reference_check_cosine <bfloat16_t>  ();
+    ret += reference_check_cosine <double>      ();
+    ret += reference_check_cosine <float>       ();
+
+    for (dimension_t k = 0x0; k < rounds; k++)
+        for (dimension_t i = 0x0; i < reference_short + longs; i++)
+        {
+            const dimension_t count = i < reference_short
+                                    ? i : reference_long[i - reference_short];
+
+            ret += reference_check_convert  (count, state);
+            ret += reference_check_sparse   (count, state);
+
+            for (dimension_t j = 0x0; j < reference_offsets; j++)
+            {
+                ret += reference_check <double>         (count, j, state);
+                ret += reference_check <float>          (count, j, state);
+                ret += reference_check_compare <double> (count, j, state);
+                ret += reference_check_compare <float>  (count, j, state);
+                ret += reference_check_hash             (count, j, state);
+                ret += reference_check_matrix <double>  (count, j, state);
+                ret += reference_check_matrix <float>   (count, j, state);
+                ret += reference_check_quantised        (count, j, state);
+            };
+        };
+
+    return ret;
+}
+
+/******************************************************************************/
@@ -36,7 +36,7 @@
  */
 
 // This project.
-#include "Rnfpp.hpp"
+#include "kernels.hpp"
 
 
 
@@ -47,8 +47,12 @@
  * The setter method for the components held by this vector.
  */
 
-void Rnfpp :: set_components (const fvec_t & components) noexcept
+template <typename T>
+void Rnpp <T> :: set_components (const vec_t & components) noexcept
 {
+    KERNEL_PROFILE (Rnpp_set_components, components.size (),
+                    this -> components.capacity () < components.size ()
+                    ? components.size () * sizeof (T) : 0x0);
     this -> components = components;
     return;
 }
@@ -62,10 +66,54 @@ void Rnfpp :: set_components (const fvec_t & components) noexcept
  * The setter method for the components held by this vector.
  */
 
-void Rnfpp :: set_components (const Rnfpp & components) noexcept
+template <typename T>
+void Rnpp <T> :: set_components (const Rnpp <T> & components) noexcept
 {
+    KERNEL_PROFILE (Rnpp_set_components, components.get_dimension (),
+                    this -> components.capacity () < components.get_dimension ()
+                    ? components.get_dimension () * sizeof (T) : 0x0);
     this -> components = components.get_components ();
     return;
 }
 
+
+
+/**
+ * \brief   Set the components object.
+ * \param   components  The components to adopt.
+ *
+ * The setter method for the components held by this vector.  The storage of the
+ * given vector is taken over without copying it.
+ */
+
+template <typename T>
+void Rnpp <T> :: set_components (vec_t && components) noexcept
+{
+    KERNEL_PROFILE (Rnpp_set_components, components.size (), 0x0);
+    this -> components = move (components);
+    return;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp :: set_components (const Rnbpp :: vec_t &) noexcept;
+template void Rnbpp :: set_components (const Rnbpp &) noexcept;
+template void Rnbpp :: set_components (Rnbpp :: vec_t &&) noexcept;
+
+template void Rndpp :: set_components (const Rndpp :: vec_t &) noexcept;
+template void Rndpp :: set_components (const Rndpp &) noexcept;
+template void Rndpp :: set_components (Rndpp :: vec_t &&) noexcept;
+
+template void Rnfpp :: set_components (const Rnfpp :: vec_t &) noexcept;
+template void Rnfpp :: set_components (const Rnfpp &) noexcept;
+template void Rnfpp :: set_components (Rnfpp :: vec_t &&) noexcept;
+
+template void Rnhpp :: set_components (const Rnhpp :: vec_t &) noexcept;
+template void Rnhpp :: set_components (const Rnhpp &) noexcept;
+template void Rnhpp :: set_components (Rnhpp :: vec_t &&) noexcept;
+
 /******************************************************************************/
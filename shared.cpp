@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The shared vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        shared.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the shared vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <limits>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: numeric_limits;
+
+
+
+/**
+ * \brief   Construct a new Rnpp_shared object holding an empty vector.
+ *
+ * The norm of each new vector is unknown until it is requested the first time.
+ */
+
+template <typename T>
+Rnpp_shared <T> :: Rnpp_shared (void)
+    : cached    (make_shared <atomic <scalar_t> >
+                     (numeric_limits <scalar_t> :: quiet_NaN ()))
+    , rnpp      (make_shared <Rnpp <T> > ())
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp_shared object from a copy of a vector.
+ * \param   rnpp    The vector to copy.
+ *
+ * This is the only copy of the components until a copy of this object is
+ * mutated.
+ */
+
+template <typename T>
+Rnpp_shared <T> :: Rnpp_shared (const Rnpp <T> & rnpp)
+    : cached    (make_shared <atomic <scalar_t> >
+                     (numeric_limits <scalar_t> :: quiet_NaN ()))
+    , rnpp      (make_shared <Rnpp <T> > (rnpp))
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp_shared object taking over a vector.
+ * \param   rnpp    The vector to take over.
+ *
+ * The components are moved rather than copied.
+ */
+
+template <typename T>
+Rnpp_shared <T> :: Rnpp_shared (Rnpp <T> && rnpp)
+    : cached    (make_shared <atomic <scalar_t> >
+                     (numeric_limits <scalar_t> :: quiet_NaN ()))
+    , rnpp      (make_shared <Rnpp <T> > (move (rnpp)))
+{
+    return;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp_shared :: Rnpp_shared (void);
+template Rnbpp_shared :: Rnpp_shared (const Rnbpp &);
+template Rnbpp_shared :: Rnpp_shared (Rnbpp &&);
+
+template Rndpp_shared :: Rnpp_shared (void);
+template Rndpp_shared :: Rnpp_shared (const Rndpp &);
+template Rndpp_shared :: Rnpp_shared (Rndpp &&);
+
+template Rnfpp_shared :: Rnpp_shared (void);
+template Rnfpp_shared :: Rnpp_shared (const Rnfpp &);
+template Rnfpp_shared :: Rnpp_shared (Rnfpp &&);
+
+template Rnhpp_shared :: Rnpp_shared (void);
+template Rnhpp_shared :: Rnpp_shared (const Rnhpp &);
+template Rnhpp_shared :: Rnpp_shared (Rnhpp &&);
+
+/******************************************************************************/
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The shared vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        shared_cosine.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the shared vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   The cosine of the angle to another shared vector.
+ * \param   other   The vector to compare with.
+ * \return  The cosine similarity.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * Both norms are taken from the caches, such that comparing the same vectors
+ * repeatedly costs a single inner product each time.  The cosine of a zero
+ * vector is NaN.
+ */
+
+template <typename T>
+typename Rnpp_shared <T> :: scalar_t
+Rnpp_shared <T> :: cosine (const Rnpp_shared & other) const
+{
+    return this -> rnpp -> inner (* other.rnpp)
+         / (this -> norm () * other.norm ());
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template float Rnbpp_shared :: cosine (const Rnbpp_shared &) const;
+template double Rndpp_shared :: cosine (const Rndpp_shared &) const;
+template float Rnfpp_shared :: cosine (const Rnfpp_shared &) const;
+template float Rnhpp_shared :: cosine (const Rnhpp_shared &) const;
+
+/******************************************************************************/
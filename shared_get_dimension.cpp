@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The shared vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        shared_get_dimension.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the shared vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Get the dimension of the shared vector.
+ * \return  The dimension.
+ */
+
+template <typename T>
+dimension_t Rnpp_shared <T> :: get_dimension (void) const noexcept
+{
+    return this -> rnpp -> get_dimension ();
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template dimension_t Rnbpp_shared :: get_dimension (void) const noexcept;
+template dimension_t Rndpp_shared :: get_dimension (void) const noexcept;
+template dimension_t Rnfpp_shared :: get_dimension (void) const noexcept;
+template dimension_t Rnhpp_shared :: get_dimension (void) const noexcept;
+
+/******************************************************************************/
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The shared vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        shared_mutate.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the shared vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <atomic>
+#include <limits>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: atomic_thread_fence;
+using std :: memory_order_acquire;
+using std :: numeric_limits;
+
+
+
+/**
+ * \brief   The invalidation of a cached norm at the end of a scope.
+ *
+ * The norm is invalidated when the scope is left, regularly or by an exception,
+ * such that no value computed during a modification survives it.
+ */
+
+template <typename S>
+struct shared_invalidation
+{
+    atomic <S> &    cached;
+
+    ~shared_invalidation (void)
+    {
+        this -> cached.store (numeric_limits <S> :: quiet_NaN ());
+        return;
+    };
+};
+
+
+
+/**
+ * \brief   Modify the vector.
+ * \param   mutation    The modification to apply to the vector.
+ *
+ * In case the vector is shared with other objects, it is cloned once and this
+ * object continues with the clone; the other objects keep the original.
+ * Further calls do not copy again until this object is copied.  The given
+ * modification is applied to the vector owned by this object alone; the
+ * reference passed to it must not be kept beyond the call since the vector
+ * might be shared again afterwards.  The cached norm of this object is
+ * invalidated after the modification has finished, even if it throws, such
+ * that a norm requested meanwhile is not kept.
+ *
+ * The uniqueness is determined by the reference count, which is read without
+ * ordering.  Hence, a fence makes the reads of all former owners, which have
+ * released their references in the meantime, happen before the modification.
+ * This object must not be used by other threads during the call; other objects
+ * sharing the same vector may be, including their destruction.
+ */
+
+template <typename T>
+void Rnpp_shared <T> :: mutate (const function <void (Rnpp <T> &)> & mutation)
+{
+    const scalar_t nan = numeric_limits <scalar_t> :: quiet_NaN ();
+
+    if (this -> rnpp.use_count () != 0x1)
+    {
+        this -> cached  = make_shared <atomic <scalar_t> > (nan);
+        this -> rnpp    = make_shared <Rnpp <T> > (* this -> rnpp);
+    }
+    else
+        atomic_thread_fence (memory_order_acquire);
+
+    const shared_invalidation <scalar_t> invalidation = {* this -> cached};
+
+    mutation (* this -> rnpp);
+    return;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnbpp_shared :: mutate (const function <void (Rnbpp &)> &);
+template void Rndpp_shared :: mutate (const function <void (Rndpp &)> &);
+template void Rnfpp_shared :: mutate (const function <void (Rnfpp &)> &);
+template void Rnhpp_shared :: mutate (const function <void (Rnhpp &)> &);
+
+/******************************************************************************/
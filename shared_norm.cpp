@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The shared vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        shared_norm.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the shared vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <cmath>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: isnan;
+
+
+
+/**
+ * \brief   The Euclidean 2-norm of the shared vector.
+ * \return  The norm.
+ *
+ * The norm is computed on the first request and cached for all copies of this
+ * object until the vector is mutated.  Since write access is confined to
+ * `mutate`, which invalidates the cache when the modification has finished, a
+ * cached norm always belongs to the current components.  Concurrent first
+ * requests compute the same value, so either of them may be stored.
+ */
+
+template <typename T>
+typename Rnpp_shared <T> :: scalar_t Rnpp_shared <T> :: norm (void)
+    const noexcept
+{
+    scalar_t ret = this -> cached -> load ();
+
+    if (isnan (ret))
+    {
+        ret = this -> rnpp -> norm ();
+        this -> cached -> store (ret);
+    };
+
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template float Rnbpp_shared :: norm (void) const noexcept;
+template double Rndpp_shared :: norm (void) const noexcept;
+template float Rnfpp_shared :: norm (void) const noexcept;
+template float Rnhpp_shared :: norm (void) const noexcept;
+
+/******************************************************************************/
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The SimHash class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        simhash.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the SimHash class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Construct a new Rnpp_simhash object.
+ *
+ * This is the default constructor which will prepare an empty hash family.
+ */
+
+Rnpp_simhash :: Rnpp_simhash (void) : bits (0x0), dimension (0x0)
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp_simhash object.
+ * \param   dimension   The dimension of the vectors to hash.
+ * \param   bits        The number of bits per signature.
+ * \param   seed        The seed of the random hyperplanes.
+ * \throws  invalid_argument    In case of an invalid number of bits.
+ *
+ * This constructor draws `bits` random hyperplanes through the origin with
+ * normally distributed normals.  Equal seeds will yield equal hyperplanes,
+ * regardless of the platform.
+ */
+
+Rnpp_simhash :: Rnpp_simhash (const dimension_t  dimension,
+                              const dimension_t  bits,
+                              const uint64_t     seed)
+    : bits (bits), dimension (dimension), planes (bits * dimension)
+{
+    if (! bits || bits > 0x40)
+        RNPP_VIOLATION (invalid_argument,
+                        "A signature requires 1 up to 64 bits!");
+
+    uint64_t state = seed;
+
+    for (dimension_t i = 0x0; i < this -> planes.size (); i++)
+        this -> planes[i] = float (kernel_normal (state));
+
+    return;
+}
+
+
+
+/**
+ * \brief   Destruct an Rnpp_simhash object.
+ *
+ * This is the default destructor.
+ */
+
+Rnpp_simhash :: ~Rnpp_simhash (void)
+{
+    return;
+}
+
+/******************************************************************************/
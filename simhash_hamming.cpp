@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The SimHash class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        simhash_hamming.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the SimHash class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <bitset>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: bitset;
+
+
+
+/**
+ * \brief   Count the differing bits of two signatures.
+ * \param   a   The first signature.
+ * \param   b   The second signature.
+ * \return  The Hamming distance of both signatures.
+ *
+ * The Hamming distance of two signatures estimates the angle between the
+ * hashed vectors:  each bit differs with a probability of the angle over pi.
+ */
+
+dimension_t Rnpp_simhash :: hamming (const uint64_t a, const uint64_t b)
+    noexcept
+{
+    return dimension_t (bitset <0x40> (a ^ b).count ());
+}
+
+/******************************************************************************/
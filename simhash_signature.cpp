@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The SimHash class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        simhash_signature.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the SimHash class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Compute the signature of a vector.
+ * \param   rnpp    The vector to hash.
+ * \return  The signature.
+ * \throws  invalid_argument    In case of a different dimension.
+ *
+ * Bit `i` of the signature is set if the vector lies on the positive side of
+ * the `i`-th hyperplane.  Similar vectors hence share most of their bits.
+ */
+
+template <typename T>
+uint64_t Rnpp_simhash :: signature (const Rnpp <T> & rnpp) const
+{
+    this -> assert_same_dimension (rnpp.get_dimension ());
+
+    const T *       x   = rnpp.get_components ().data ();
+    const float *   p   = this -> planes.data ();
+    uint64_t        ret = 0x0;
+
+    for (dimension_t i = 0x0; i < this -> bits; i++, p += this -> dimension)
+        if (kernel_inner (x, p, this -> dimension) >= 0x0)
+            ret |= uint64_t (0x1) << i;
+
+    return ret;
+}
+
+
+
+/**
+ * \brief   Compute the signatures of all rows of a batch.
+ * \param   batch   The batch to hash.
+ * \return  The signature of each row, in order.
+ * \throws  invalid_argument    In case of a different dimension.
+ *
+ * This method hashes each row like the overload for single vectors does.
+ */
+
+template <typename T>
+vector <uint64_t> Rnpp_simhash :: signature (const Rnpp_batch <T> & batch)
+    const
+{
+    this -> assert_same_dimension (batch.get_dimension ());
+
+    const T *           x   = batch.get_components ().data ();
+    vector <uint64_t>   ret = vector <uint64_t> (batch.get_count ());
+
+    for (dimension_t i = 0x0; i < ret.size (); i++, x += this -> dimension)
+    {
+        const float * p = this -> planes.data ();
+
+        for (dimension_t j = 0x0; j < this -> bits; j++, p += this -> dimension)
+            if (kernel_inner (x, p, this -> dimension) >= 0x0)
+                ret[i] |= uint64_t (0x1) << j;
+    };
+
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template uint64_t Rnpp_simhash :: signature (const Rnbpp &) const;
+template uint64_t Rnpp_simhash :: signature (const Rnfpp &) const;
+template uint64_t Rnpp_simhash :: signature (const Rnhpp &) const;
+
+template vector <uint64_t>
+Rnpp_simhash :: signature (const Rnbpp_batch &) const;
+template vector <uint64_t>
+Rnpp_simhash :: signature (const Rnfpp_batch &) const;
+template vector <uint64_t>
+Rnpp_simhash :: signature (const Rnhpp_batch &) const;
+
+/******************************************************************************/
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The store snapshot class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        snapshot.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the store snapshot class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Take a snapshot of a store.
+ * \param   store   The store to take the snapshot of.
+ *
+ * The snapshot counts itself in the current epoch of the store first.  If the
+ * epoch advanced meanwhile, the count is moved to the new one.  Only then, the
+ * storage is loaded, such that it cannot be freed before this snapshot is
+ * destroyed.  The erasures are loaded before the vectors, hence each erasure of
+ * the snapshot refers to a vector of the snapshot.
+ */
+
+Rnpp_snapshot :: Rnpp_snapshot (Rnpp_store & store)
+    : count     (0x0)
+    , data      (nullptr)
+    , epoch     (store.epoch.load ())
+    , erasures  (0x0)
+    , store     (& store)
+{
+    store.active[this -> epoch & 0x1]++;
+
+    while (store.epoch.load () != this -> epoch)
+    {
+        store.active[this -> epoch & 0x1]--;
+        this -> epoch = store.epoch.load ();
+        store.active[this -> epoch & 0x1]++;
+    };
+
+    this -> data        = store.current.load ();
+    this -> erasures    = this -> data -> erasures.load ();
+    this -> count       = this -> data -> appended.load ();
+    return;
+}
+
+
+
+/**
+ * \brief   Take over a snapshot.
+ * \param   snapshot    The snapshot to take over.
+ *
+ * The given snapshot does no longer pin the storage.
+ */
+
+Rnpp_snapshot :: Rnpp_snapshot (Rnpp_snapshot && snapshot) noexcept
+    : count     (snapshot.count)
+    , data      (snapshot.data)
+    , epoch     (snapshot.epoch)
+    , erasures  (snapshot.erasures)
+    , store     (snapshot.store)
+{
+    snapshot.store = nullptr;
+    return;
+}
+
+
+
+/**
+ * \brief   Release the storage.
+ *
+ * The storage is not freed by this destructor but by a later clearing of the
+ * store.
+ */
+
+Rnpp_snapshot :: ~Rnpp_snapshot (void)
+{
+    if (this -> store)
+        this -> store -> active[this -> epoch & 0x1]--;
+
+    return;
+}
+
+/******************************************************************************/
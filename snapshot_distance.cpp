@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The store snapshot class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        snapshot_distance.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the store snapshot class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <limits>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: numeric_limits;
+
+
+
+/**
+ * \brief   The distances of all vectors to a query vector.
+ * \param   query   The vector to calculate the distances to.
+ * \return  The distance of each vector, in order; NaN for the erased ones.
+ * \throws  invalid_argument    In case the dimensions differ.
+ *
+ * The dimension is checked once.  Each segment is scanned like the rows of a
+ * batch.
+ */
+
+fvec_t Rnpp_snapshot :: distance (const Rnfpp & query) const
+{
+    this -> assert_same_dimension (query);
+
+    const float *       q   = query.get_components ().data ();
+    const dimension_t   d   = this -> data -> dimension;
+    const float         nan = numeric_limits <float> :: quiet_NaN ();
+    fvec_t              ret = fvec_t (this -> count);
+
+    this -> data -> scan (this -> count, [&] (const dimension_t         first,
+                                              const dimension_t         rows,
+                                              const float *             row,
+                                              const atomic <uint64_t> * states)
+    {
+        for (dimension_t i = 0x0; i < rows; i++, row += d)
+            ret[first + i] = kernel_store_erased (states[i].load (),
+                                                  this -> erasures)
+                           ? nan
+                           : sqrt (kernel_distance_squared (row, q, d));
+    });
+
+    return ret;
+}
+
+/******************************************************************************/
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The sparse vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        sparse.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the sparse vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: is_sorted;
+using std :: stable_sort;
+
+
+
+/*
+ * Internal helpers.
+ */
+
+/**
+ * \brief   Ensure a dimension to be addressable by the indices.
+ * \param   dimension   The dimension to test.
+ * \return  The given dimension.
+ * \throws  invalid_argument    In case the dimension is too large.
+ *
+ * The indices of the non-zero components are stored with 32 bits in order to
+ * save memory.
+ */
+
+static dimension_t sparse_dimension (const dimension_t dimension)
+{
+    if (uint64_t (dimension) > uint64_t (0xffffffff) + 0x1)
+        RNPP_VIOLATION (invalid_argument,
+                        "The dimension exceeds the sparse indices!");
+
+    return dimension;
+}
+
+
+
+/*
+ * Class methods.
+ */
+
+/**
+ * \brief   Construct a new Rnspp object.
+ *
+ * This is the default constructor which will prepare an empty vector.
+ */
+
+Rnspp :: Rnspp (void) : dimension (0x0)
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnspp object with a given dimension.
+ * \param   dimension   The dimension of the vector.
+ * \throws  invalid_argument    In case the dimension is too large.
+ *
+ * The vector will be zero, that is, without any non-zero component.
+ */
+
+Rnspp :: Rnspp (const dimension_t dimension)
+    : dimension (sparse_dimension (dimension))
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnspp object from pairs of indices and values.
+ * \param   dimension   The dimension of the vector.
+ * \param   indices     The indices of the given values.
+ * \param   values      The values at the given indices.
+ * \throws  invalid_argument    In case of an invalid argument.
+ * \throws  out_of_range        In case an index exceeds the dimension.
+ *
+ * The pairs may be given in any order.  They will be sorted by their indices,
+ * values of repeated indices will be summed up and zeros will be dropped.
+ */
+
+Rnspp :: Rnspp (const dimension_t           dimension,
+                const vector <uint32_t> &   indices,
+                const fvec_t &              values)
+    : dimension (sparse_dimension (dimension))
+{
+    if (indices.size () != values.size ())
+        RNPP_VIOLATION (invalid_argument,
+                        "The indices and values do not form pairs!");
+
+    const dimension_t       n       = indices.size ();
+    vector <dimension_t>    order   = vector <dimension_t> (n);
+
+    for (dimension_t k = 0x0; k < n; k++)
+    {
+        if (indices[k] >= dimension)
+            RNPP_VIOLATION (out_of_range,
+                            "This index position does not exist!");
+
+        order[k] = k;
+    };
+
+    if (! is_sorted (indices.begin (), indices.end ()))
+        stable_sort (order.begin (), order.end (),
+                     [&] (const dimension_t a, const dimension_t b)
+                     {
+                         return indices[a] < indices[b];
+                     });
+
+    this -> indices.reserve (n);
+    this -> values.reserve (n);
+
+    for (dimension_t k = 0x0; k < n;)
+    {
+        const uint32_t  index   = indices[order[k]];
+        float           sum     = 0x0;
+
+        for (; k < n && indices[order[k]] == index; k++)
+            sum += values[order[k]];
+
+        if (sum != 0x0)
+        {
+            this -> indices.push_back (index);
+            this -> values.push_back (sum);
+        };
+    };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnspp object from a dense vector.
+ * \param   dense   The vector to convert.
+ * \throws  invalid_argument    In case the dimension is too large.
+ *
+ * Only the non-zero components of the given vector will be kept.  They are
+ * counted first such that the memory is allocated exactly once.
+ */
+
+Rnspp :: Rnspp (const Rnfpp & dense)
+    : dimension (sparse_dimension (dense.get_dimension ()))
+{
+    const float *   x = dense.get_components ().data ();
+    dimension_t     n = 0x0;
+
+    for (dimension_t j = 0x0; j < this -> dimension; j++)
+        n += x[j] != 0x0;
+
+    this -> indices.reserve (n);
+    this -> values.reserve (n);
+
+    for (dimension_t j = 0x0; j < this -> dimension; j++)
+        if (x[j] != 0x0)
+        {
+            this -> indices.push_back (uint32_t (j));
+            this -> values.push_back (x[j]);
+        };
+
+    return;
+}
+
+
+
+/**
+ * \brief   Destroy the Rnspp object.
+ *
+ * This is the default destructor.
+ */
+
+Rnspp :: ~Rnspp (void)
+{
+    return;
+}
+
+/******************************************************************************/
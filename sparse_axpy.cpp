@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The sparse vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        sparse_axpy.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the sparse vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   Add a multiple of another sparse vector to this vector.
+ * \param   alpha   The factor of `x`.
+ * \param   x       The vector to scale.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method computes `this += alpha * x`.  Both lists of non-zero components
+ * are merged into new ones which are allocated once with room for both.
+ * Components cancelling each other out are dropped.
+ */
+
+void Rnspp :: axpy (const float alpha, const Rnspp & x)
+{
+    this -> assert_same_dimension (x.dimension);
+
+    if (alpha == 0x0 || x.values.empty ())
+        return;
+
+    const dimension_t   na          = this -> values.size ();
+    const dimension_t   nb          = x.values.size ();
+    vector <uint32_t>   indices;
+    fvec_t              values;
+    dimension_t         i           = 0x0;
+    dimension_t         j           = 0x0;
+
+    indices.reserve (na + nb);
+    values.reserve (na + nb);
+
+    while (i < na || j < nb)
+    {
+        float       value = 0x0;
+        uint32_t    index = 0x0;
+
+        if (j == nb || (i < na && this -> indices[i] < x.indices[j]))
+        {
+            index = this -> indices[i];
+            value = this -> values[i++];
+        }
+        else if (i == na || x.indices[j] < this -> indices[i])
+        {
+            index = x.indices[j];
+            value = alpha * x.values[j++];
+        }
+        else
+        {
+            index = x.indices[j];
+            value = this -> values[i++] + alpha * x.values[j++];
+        };
+
+        if (value != 0x0)
+        {
+            indices.push_back (index);
+            values.push_back (value);
+        };
+    };
+
+    this -> indices.swap (indices);
+    this -> values.swap (values);
+    return;
+}
+
+/******************************************************************************/
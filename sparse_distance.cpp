@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The sparse vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        sparse_distance.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the sparse vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Calculate the distance to a dense vector.
+ * \param   other   The dense vector.
+ * \return  The Euclidean distance.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method corrects the norm of the dense vector at the non-zero components
+ * of this vector instead of converting this vector.
+ */
+
+float Rnspp :: distance (const Rnfpp & other) const
+{
+    this -> assert_same_dimension (other.get_dimension ());
+    return sqrt (kernel_sparse_distance (this -> indices.data (),
+                                         this -> values.data (),
+                                         this -> values.size (),
+                                         other.get_components ().data (),
+                                         this -> dimension));
+}
+
+
+
+/**
+ * \brief   Calculate the distance to another sparse vector.
+ * \param   other   The sparse vector.
+ * \return  The Euclidean distance.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method merges the non-zero components of both vectors.
+ */
+
+float Rnspp :: distance (const Rnspp & other) const
+{
+    this -> assert_same_dimension (other.dimension);
+    return sqrt (kernel_sparse_distance (this -> indices.data (),
+                                         this -> values.data (),
+                                         this -> values.size (),
+                                         other.indices.data (),
+                                         other.values.data (),
+                                         other.values.size ()));
+}
+
+/******************************************************************************/
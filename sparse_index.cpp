@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The sparse vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        sparse_index.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the sparse vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: lower_bound;
+
+
+
+/**
+ * \brief   The index operator.
+ * \param   index   The index position to query.
+ * \return  The requested component.
+ * \throws  out_of_range    In case the given index position is invalid.
+ *
+ * This method searches the indices of the non-zero components for the given
+ * index position.  Components which are not stored are zero.  Since only the
+ * non-zero components are stored, the result is a copy rather than a
+ * reference.
+ */
+
+float Rnspp :: operator [] (const dimension_t index) const
+{
+    this -> assert_range (index);
+
+    const vector <uint32_t> :: const_iterator i
+        = lower_bound (this -> indices.begin (), this -> indices.end (),
+                       uint32_t (index));
+
+    if (i == this -> indices.end () || * i != index)
+        return 0x0;
+
+    return this -> values[dimension_t (i - this -> indices.begin ())];
+}
+
+/******************************************************************************/
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The sparse vector class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        sparse_scatter.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the sparse vector class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Add a multiple of this vector to a dense one.
+ * \param   alpha   The factor of this vector.
+ * \param   y       The dense vector to update.
+ * \throws  invalid_argument    In case the vectors are of different dimensions.
+ *
+ * This method computes `y += alpha * this`, the sparse `axpy` of a dense
+ * target, by touching the non-zero components of this vector only.
+ */
+
+void Rnspp :: scatter (const float alpha, Rnfpp & y) const
+{
+    this -> assert_same_dimension (y.get_dimension ());
+    kernel_sparse_scatter (alpha, this -> indices.data (),
+                           this -> values.data (), this -> values.size (),
+                           y.get_components ().data ());
+    return;
+}
+
+/******************************************************************************/
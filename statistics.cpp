@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The statistics class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        statistics.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the statistics class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <limits>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: numeric_limits;
+
+
+
+/**
+ * \brief   Construct a new Rnpp_statistics object.
+ *
+ * This is the default constructor which will prepare statistics of vectors
+ * without any components.
+ */
+
+Rnpp_statistics :: Rnpp_statistics (void) : count (0x0), dimension (0x0)
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Construct a new Rnpp_statistics object.
+ * \param   dimension   The dimension of the rows to describe.
+ * \param   covariance  Whether to track the covariance matrix as well.
+ *
+ * This constructor prepares the statistics of no rows at all.  The minima are
+ * positive and the maxima negative infinity.  Tracking the covariance matrix
+ * requires memory and time quadratic in the dimension.
+ */
+
+Rnpp_statistics :: Rnpp_statistics (const dimension_t  dimension,
+                                    const bool         covariance)
+    : comoments (covariance ? dimension * dimension : 0x0),
+      count (0x0),
+      dimension (dimension),
+      maximum (dimension, - numeric_limits <double> :: infinity ()),
+      mean (dimension),
+      minimum (dimension, numeric_limits <double> :: infinity ()),
+      moments (dimension)
+{
+    return;
+}
+
+
+
+/**
+ * \brief   Destruct an Rnpp_statistics object.
+ *
+ * This is the default destructor.
+ */
+
+Rnpp_statistics :: ~Rnpp_statistics (void)
+{
+    return;
+}
+
+/******************************************************************************/
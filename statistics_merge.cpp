@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The statistics class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        statistics_merge.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the statistics class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+
+// This project.
+#include "Rnfpp.hpp"
+
+// Namespace settings.
+using std :: max;
+using std :: min;
+
+
+
+/**
+ * \brief   Merge other statistics into these ones.
+ * \param   other   The statistics to merge.
+ * \throws  invalid_argument    In case the statistics are incompatible.
+ *
+ * This method combines the statistics of two disjoint sets of rows as if all
+ * rows had been accumulated here.  With `n` rows on this side, `m` rows on the
+ * other one and the difference `delta` of the means, the squared deviations and
+ * their products grow by the ones of the other side plus
+ * `delta * delta^T * n * m / (n + m)`.
+ */
+
+void Rnpp_statistics :: merge (const Rnpp_statistics & other)
+{
+    this -> assert_same_dimension (other.dimension);
+
+    if (this -> comoments.size () != other.comoments.size ())
+        RNPP_VIOLATION (invalid_argument,
+                        "The statistics track different moments!");
+
+    if (! other.count)
+        return;
+
+    const dimension_t   d       = this -> dimension;
+    const double        n       = double (this -> count);
+    const double        m       = double (other.count);
+    const double        weight  = n * m / (n + m);
+    vector <double>     delta   = vector <double> (d);
+
+    for (dimension_t j = 0x0; j < d; j++)
+        delta[j] = other.mean[j] - this -> mean[j];
+
+    for (dimension_t i = 0x0; ! this -> comoments.empty () && i < d; i++)
+        for (dimension_t j = 0x0; j < d; j++)
+            this -> comoments[i * d + j] += other.comoments[i * d + j]
+                                          + delta[i] * delta[j] * weight;
+
+    for (dimension_t j = 0x0; j < d; j++)
+    {
+        this -> maximum[j]  = max (this -> maximum[j], other.maximum[j]);
+        this -> mean[j]     += delta[j] * m / (n + m);
+        this -> minimum[j]  = min (this -> minimum[j], other.minimum[j]);
+        this -> moments[j]  += other.moments[j] + delta[j] * delta[j] * weight;
+    };
+
+    this -> count += other.count;
+    return;
+}
+
+/******************************************************************************/
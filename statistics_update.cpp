@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The statistics class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        statistics_update.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the statistics class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// The C++ standard library.
+#include <algorithm>
+#include <type_traits>
+
+// This project.
+#include "kernels.hpp"
+
+// Namespace settings.
+using std :: fill;
+using std :: is_same;
+
+
+
+/*
+ * Internal helpers.
+ */
+
+/**
+ * \brief   Provide rows in their scalar type.
+ * \param   in      The components to provide.
+ * \param   buffer  The buffer to convert the components into, if necessary.
+ * \param   count   The number of components.
+ * \return  The components in their scalar type.
+ *
+ * Components of a reduced precision are widened into the buffer while `float`
+ * and `double` components are passed through.
+ */
+
+template <typename T>
+static inline const float * statistics_rows (const T *          in,
+                                             float *            buffer,
+                                             const dimension_t  count)
+    noexcept
+{
+    kernel_convert (in, buffer, count);
+    return buffer;
+}
+
+static inline const float * statistics_rows (const float *      in,
+                                             float *,
+                                             const dimension_t)  noexcept
+{
+    return in;
+}
+
+static inline const double * statistics_rows (const double *    in,
+                                              double *,
+                                              const dimension_t) noexcept
+{
+    return in;
+}
+
+
+
+/*
+ * Class methods.
+ */
+
+/**
+ * \brief   Accumulate a panel of rows.
+ * \param   rows        The rows to accumulate.
+ * \param   count       The number of rows, at most `kernel_block`.
+ * \param   threads     The maximal number of threads to use.
+ * \param   panel       A buffer for `count * dimension` scalars.
+ * \param   products    A buffer for `dimension * dimension` scalars.
+ * \param   scratch     A buffer for `2 * dimension` numbers.
+ *
+ * The moments of the panel are computed about its own mean, which keeps the
+ * deviations small, and merged into the running ones afterwards.  If the
+ * covariance is tracked, the deviations are transposed into `panel` and their
+ * products are computed by the matrix kernel, split into one range of rows of
+ * the covariance matrix per thread.
+ */
+
+template <typename S>
+void Rnpp_statistics :: accumulate (const S *          rows,
+                                    const dimension_t  count,
+                                    const dimension_t  threads,
+                                    vector <S> &       panel,
+                                    vector <S> &       products,
+                                    vector <double> &  scratch)
+{
+    const dimension_t   d       = this -> dimension;
+    const double        n       = double (this -> count);
+    const double        m       = double (count);
+    const double        weight  = n * m / (n + m);
+    double *            delta   = scratch.data ();
+    double *            squares = scratch.data () + d;
+
+    fill (scratch.begin (), scratch.end (), 0.0);
+
+    for (dimension_t r = 0x0; r < count; r++)
+    {
+        const S * x = rows + r * d;
+
+        for (dimension_t j = 0x0; j < d; j++)
+        {
+            delta[j]            += x[j];
+            this -> maximum[j]  = max (this -> maximum[j], double (x[j]));
+            this -> minimum[j]  = min (this -> minimum[j], double (x[j]));
+        };
+    };
+
+    for (dimension_t j = 0x0; j < d; j++)
+        delta[j] /= m;
+
+    for (dimension_t r = 0x0; r < count; r++)
+    {
+        const S * x = rows + r * d;
+
+        for (dimension_t j = 0x0; j < d; j++)
+            squares[j] += (x[j] - delta[j]) * (x[j] - delta[j]);
+    };
+
+    for (dimension_t r = 0x0; ! this -> comoments.empty () && r < count; r++)
+    {
+        const S * x = rows + r * d;
+
+        for (dimension_t j = 0x0; j < d; j++)
+            panel[j * count + r] = S (x[j] - delta[j]);
+    };
+
+    for (dimension_t j = 0x0; j < d; j++)
+        delta[j] -= this -> mean[j];
+
+    if (! this -> comoments.empty ())
+        kernel_parallel_for (d, threads, [&] (const dimension_t begin,
+                                              const dimension_t end,
+                                              const dimension_t)
+        {
+            kernel_inner_matrix (panel.data () + begin * count, end - begin,
+                                 panel.data (), d, count,
+                                 products.data () + begin * d);
+
+            for (dimension_t i = begin; i < end; i++)
+                for (dimension_t j = 0x0; j < d; j++)
+                    this -> comoments[i * d + j] += products[i * d + j]
+                                                  + delta[i] * delta[j]
+                                                  * weight;
+        });
+
+    for (dimension_t j = 0x0; j < d; j++)
+    {
+        this -> mean[j]     += delta[j] * m / (n + m);
+        this -> moments[j]  += squares[j] + delta[j] * delta[j] * weight;
+    };
+
+    this -> count += count;
+    return;
+}
+
+
+
+/**
+ * \brief   Accumulate all rows of a batch.
+ * \param   batch   The batch to accumulate.
+ * \param   threads The maximal number of threads to use; zero for all cores.
+ * \throws  invalid_argument    In case of a different dimension.
+ *
+ * This method reads each row exactly once.  Without the covariance, the rows
+ * are split into one contiguous range per thread, each thread accumulates its
+ * own statistics and these are merged in order afterwards.  With the
+ * covariance, the panels are accumulated one after another since the matrix
+ * products of each panel are distributed across the threads instead.
+ * Components of a reduced precision are widened panel by panel to `float`.
+ */
+
+template <typename T>
+void Rnpp_statistics :: update (const Rnpp_batch <T> & batch,
+                                const dimension_t      threads)
+{
+    typedef typename Rnpp_traits <T> :: scalar_t S;
+
+    this -> assert_same_dimension (batch.get_dimension ());
+
+    const dimension_t   d       = this -> dimension;
+    const dimension_t   n       = batch.get_count ();
+    const dimension_t   cores   = std :: thread :: hardware_concurrency ();
+    const dimension_t   workers = threads ? threads
+                                : max (cores, dimension_t (0x1));
+    const dimension_t   parts   = max (min (workers, n), dimension_t (0x1));
+    const dimension_t   block   = is_same <T, S> :: value ? 0x0
+                                : kernel_block * d;
+    const T *           x       = batch.get_components ().data ();
+    vector <S>          panel;
+    vector <S>          products;
+
+    if (! this -> comoments.empty ())
+    {
+        vector <S>      buffer  = vector <S> (block);
+        vector <double> scratch = vector <double> (0x2 * d);
+
+        panel       = vector <S> (kernel_block * d);
+        products    = vector <S> (d * d);
+
+        for (dimension_t b = 0x0; b < n; b += kernel_block)
+        {
+            const dimension_t size = min (kernel_block, n - b);
+
+            this -> accumulate (statistics_rows (x + b * d, buffer.data (),
+                                                 size * d),
+                                size, workers, panel, products, scratch);
+        };
+
+        return;
+    };
+
+    vector <Rnpp_statistics>    partials    = vector <Rnpp_statistics>
+                                              (parts, Rnpp_statistics (d,
+                                                                       false));
+    vector <S>                  buffers     = vector <S> (parts * block);
+    vector <vector <double>>    scratches   = vector <vector <double>>
+                                              (parts,
+                                               vector <double> (0x2 * d));
+
+    kernel_parallel_for (n, parts, [&] (const dimension_t begin,
+                                        const dimension_t end,
+                                        const dimension_t worker)
+    {
+        vector <double> & scratch = scratches[worker];
+
+        for (dimension_t i = begin; i < end; i += kernel_block)
+        {
+            const dimension_t size = min (kernel_block, end - i);
+
+            partials[worker].accumulate (statistics_rows (x + i * d,
+                                                          buffers.data ()
+                                                          + worker * block,
+                                                          size * d),
+                                         size, 0x1, panel, products, scratch);
+        };
+    });
+
+    for (dimension_t w = 0x0; w < parts; w++)
+        this -> merge (partials[w]);
+
+    return;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template void Rnpp_statistics :: update (const Rnbpp_batch &,
+                                         const dimension_t);
+template void Rnpp_statistics :: update (const Rndpp_batch &,
+                                         const dimension_t);
+template void Rnpp_statistics :: update (const Rnfpp_batch &,
+                                         const dimension_t);
+template void Rnpp_statistics :: update (const Rnhpp_batch &,
+                                         const dimension_t);
+
+/******************************************************************************/
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The statistics class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        statistics_variance.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the statistics class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "Rnfpp.hpp"
+
+
+
+/**
+ * \brief   The variance of each dimension.
+ * \param   sample  Whether to apply Bessel's correction.
+ * \return  The requested variances.
+ * \throws  invalid_argument    In case of too few rows.
+ *
+ * This method divides the accumulated squared deviations from the mean by the
+ * number of rows, or by the number of rows minus one for the unbiased sample
+ * variance.
+ */
+
+vector <double> Rnpp_statistics :: variance (const bool sample) const
+{
+    if (this -> count <= dimension_t (sample))
+        RNPP_VIOLATION (invalid_argument,
+                        "There are too few rows for a variance!");
+
+    const double    divisor = double (this -> count - dimension_t (sample));
+    vector <double> ret     = this -> moments;
+
+    for (dimension_t j = 0x0; j < this -> dimension; j++)
+        ret[j] /= divisor;
+
+    return ret;
+}
+
+/******************************************************************************/
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The concurrent vector store class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        store.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the concurrent vector store class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Create an empty store.
+ * \param   dimension   The dimension of the vectors to store.
+ * \param   chunk       The number of vectors of the first segment.
+ * \throws  invalid_argument    In case the segments would be empty.
+ *
+ * Each further segment holds twice as many vectors as its predecessor.  Hence,
+ * the chunk trades the memory of an almost empty store against the number of
+ * allocations while it grows.
+ */
+
+Rnpp_store :: Rnpp_store (const dimension_t dimension,
+                          const dimension_t chunk)
+    : chunk     (chunk)
+    , current   (nullptr)
+    , dimension (dimension)
+    , epoch     (0x0)
+{
+    if (! chunk)
+        RNPP_VIOLATION (invalid_argument,
+                        "A store requires segments of at least one row!");
+
+    this -> active[0x0].store (0x0);
+    this -> active[0x1].store (0x0);
+    this -> current.store (new kernel_store (chunk, dimension));
+    return;
+}
+
+
+
+/**
+ * \brief   Free the storage.
+ *
+ * No other thread may access this store or any of its snapshots any longer.
+ */
+
+Rnpp_store :: ~Rnpp_store (void)
+{
+    delete this -> current.load ();
+
+    for (dimension_t i = 0x0; i < this -> retired.size (); i++)
+        delete this -> retired[i];
+
+    return;
+}
+
+/******************************************************************************/
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The concurrent vector store class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        store_clear.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the concurrent vector store class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Remove all vectors.
+ *
+ * The storage is replaced by an empty one at once.  The existing snapshots and
+ * the insertions in progress continue on the replaced storage, which is retired
+ * until the epoch has advanced twice.  This is the only method which locks the
+ * store.
+ */
+
+void Rnpp_store :: clear (void)
+{
+    kernel_store *      fresh   = new kernel_store (this -> chunk,
+                                                    this -> dimension);
+    unique_lock <mutex> guard   (this -> lock);
+
+    this -> retired.reserve (this -> retired.size () + 0x1);
+    this -> retirements.reserve (this -> retirements.size () + 0x1);
+    this -> retired.push_back (this -> current.exchange (fresh));
+    this -> retirements.push_back (this -> epoch.load ());
+    this -> reclaim ();
+    return;
+}
+
+/******************************************************************************/
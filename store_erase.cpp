@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The concurrent vector store class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        store_erase.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the concurrent vector store class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Erase a vector.
+ * \param   index   The index of the vector.
+ * \return  Whether this call erased the vector.
+ *
+ * This method is safe to call from several threads at once without a lock.
+ * Vectors which are erased already or not published yet are left unchanged.
+ * The erasure becomes visible to new snapshots as soon as all erasures
+ * requested before are complete; the existing snapshots do not see it.
+ */
+
+bool Rnpp_store :: erase (const dimension_t index)
+{
+    const Rnpp_snapshot snapshot (* this);
+
+    return snapshot.data -> erase (index);
+}
+
+/******************************************************************************/
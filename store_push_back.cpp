@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The concurrent vector store class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        store_push_back.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the concurrent vector store class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Append a vector.
+ * \param   row The vector to append.
+ * \return  The index of the vector.
+ * \throws  invalid_argument    In case the dimensions differ.
+ *
+ * This method is safe to call from several threads at once without a lock.
+ * The vector becomes visible to new snapshots as soon as all vectors appended
+ * before are complete.  The storage is pinned like a snapshot does, such that
+ * clearing the store meanwhile does not free it.
+ */
+
+dimension_t Rnpp_store :: push_back (const Rnfpp & row)
+{
+    this -> assert_same_dimension (row);
+
+    const Rnpp_snapshot snapshot (* this);
+
+    return snapshot.data -> append (row.get_components ().data ());
+}
+
+/******************************************************************************/
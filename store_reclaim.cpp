@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The concurrent vector store class.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        store_reclaim.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the concurrent vector store class.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Free the retired storage no thread can refer to any longer.
+ *
+ * The threads pinning the storage count themselves in the counter of their
+ * epoch.  The epoch advances as soon as no thread of the previous epoch is
+ * left, since the counter of the previous epoch is shared with the next one.
+ * Storage retired during an epoch was replaced before that epoch ended, so it
+ * is unreachable once the epoch has advanced twice.  The lock of this store
+ * needs to be held.
+ */
+
+void Rnpp_store :: reclaim (void)
+{
+    for (dimension_t i = 0x0; i < 0x2; i++)
+    {
+        const uint64_t epoch = this -> epoch.load ();
+
+        if (this -> active[(epoch + 0x1) & 0x1].load ())
+            break;
+
+        this -> epoch.store (epoch + 0x1);
+    };
+
+    const uint64_t  epoch   = this -> epoch.load ();
+    dimension_t     kept    = 0x0;
+
+    for (dimension_t i = 0x0; i < this -> retired.size (); i++)
+        if (this -> retirements[i] + 0x2 <= epoch)
+            delete this -> retired[i];
+        else
+        {
+            this -> retired[kept]       = this -> retired[i];
+            this -> retirements[kept]   = this -> retirements[i];
+            kept++;
+        };
+
+    this -> retired.resize (kept);
+    this -> retirements.resize (kept);
+    return;
+}
+
+/******************************************************************************/
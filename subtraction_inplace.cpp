@@ -36,62 +36,101 @@
  */
 
 // This project.
-#include "Rnfpp.hpp"
+#include "kernels.hpp"
 
 
 
 /**
- * \brief   The subtraction operator.
- * \param   other   The vector to subtract from this one.
- * \return  The difference vector.
+ * \brief   The subtraction assignment operator.
+ * \param   other   The scalar to subtract from each component.
+ * \return  This vector.
  *
- * This method returns the difference vector.
+ * This method subtracts the given scalar from each component of this vector.
+ * The components are updated in place without allocating memory.
  */
 
-Rnfpp & Rnfpp :: operator -= (const float other) noexcept
+template <typename T>
+Rnpp <T> & Rnpp <T> :: operator -= (const scalar_t other) noexcept
 {
-    this -> set_components ((* this) - other);
+    KERNEL_PROFILE (Rnpp_subtraction, this -> get_dimension (), 0x0);
+
+    const dimension_t   dimension   = this -> get_dimension ();
+    T *                 x           = this -> components.data ();
+
+    for (dimension_t i = 0x0; i < dimension; i++)
+        x[i] = T (scalar_t (x[i]) - other);
+
     return (* this);
 }
 
 
 
 /**
- * \brief   The subtraction operator.
+ * \brief   The subtraction assignment operator.
  * \param   other   The vector to subtract from this one.
- * \return  The difference vector.
+ * \return  This vector.
  * \throws  invalid_argument    In case the vectors are of different dimensions.
  *
- * This method returns the difference vector in case both input vectors, this
- * and the other one, share the same dimension.  In case they should be of
- * different dimensions, an according exception will be thrown.
+ * This method subtracts the given vector from this one in case both share the
+ * same dimension.  In case they should be of different dimensions, an
+ * according exception will be thrown.  The components are updated in place
+ * without allocating memory.
  */
 
-Rnfpp & Rnfpp :: operator -= (const fvec_t & other)
+template <typename T>
+Rnpp <T> & Rnpp <T> :: operator -= (const vec_t & other)
 {
+    KERNEL_PROFILE (Rnpp_subtraction, this -> get_dimension (), 0x0);
     this -> assert_same_dimension (other);
-    this -> set_components ((* this) - other);
+    kernel_axpby (scalar_t (- 0x1), other.data (), scalar_t (0x1),
+                  this -> components.data (), this -> get_dimension ());
     return (* this);
 }
 
 
 
 /**
- * \brief   The subtraction operator.
+ * \brief   The subtraction assignment operator.
  * \param   other   The vector to subtract from this one.
- * \return  The difference vector.
+ * \return  This vector.
  * \throws  invalid_argument    In case the vectors are of different dimensions.
  *
- * This method returns the difference vector in case both input vectors, this
- * and the other one, share the same dimension.  In case they should be of
- * different dimensions, an according exception will be thrown.
+ * This method subtracts the given vector from this one in case both share the
+ * same dimension.  In case they should be of different dimensions, an
+ * according exception will be thrown.  The components are updated in place
+ * without allocating memory.
  */
 
-Rnfpp & Rnfpp :: operator -= (const Rnfpp & other)
+template <typename T>
+Rnpp <T> & Rnpp <T> :: operator -= (const Rnpp <T> & other)
 {
+    KERNEL_PROFILE (Rnpp_subtraction, this -> get_dimension (), 0x0);
     this -> assert_same_dimension (other);
-    this -> set_components ((* this) - other);
+    kernel_axpby (scalar_t (- 0x1), other.components.data (), scalar_t (0x1),
+                  this -> components.data (), this -> get_dimension ());
     return (* this);
 }
 
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnbpp & Rnbpp :: operator -= (const float) noexcept;
+template Rnbpp & Rnbpp :: operator -= (const Rnbpp :: vec_t &);
+template Rnbpp & Rnbpp :: operator -= (const Rnbpp &);
+
+template Rndpp & Rndpp :: operator -= (const double) noexcept;
+template Rndpp & Rndpp :: operator -= (const Rndpp :: vec_t &);
+template Rndpp & Rndpp :: operator -= (const Rndpp &);
+
+template Rnfpp & Rnfpp :: operator -= (const float) noexcept;
+template Rnfpp & Rnfpp :: operator -= (const Rnfpp :: vec_t &);
+template Rnfpp & Rnfpp :: operator -= (const Rnfpp &);
+
+template Rnhpp & Rnhpp :: operator -= (const float) noexcept;
+template Rnhpp & Rnhpp :: operator -= (const Rnhpp :: vec_t &);
+template Rnhpp & Rnhpp :: operator -= (const Rnhpp &);
+
 /******************************************************************************/
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2022 Kevin Matthes
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * \author      Kevin Matthes
+ * \brief       The reduced-precision vector classes.
+ * \copyright   (C) 2022 Kevin Matthes.
+ *              This file is licensed GPL 2 as of June 1991.
+ * \date        2022
+ * \file        widen.cpp
+ * \note        See `LICENSE' for full license.
+ *              See `README.md' for project details.
+ *
+ * This file implements the reduced-precision vector classes.
+ */
+
+/******************************************************************************/
+
+/*
+ * Includes.
+ */
+
+// This project.
+#include "kernels.hpp"
+
+
+
+/**
+ * \brief   Convert this vector to its scalar type.
+ * \return  The equivalent vector of the scalar type.
+ *
+ * This method widens the components of a reduced precision to `float`.  The
+ * conversion is lossless; vectors of any other type are copied.
+ */
+
+template <typename T>
+Rnpp <typename Rnpp <T> :: scalar_t> Rnpp <T> :: widen (void) const
+{
+    Rnpp <scalar_t> ret = Rnpp <scalar_t> (this -> get_dimension ());
+
+    kernel_convert (this -> components.data (), ret.get_components ().data (),
+                    this -> get_dimension ());
+
+    return ret;
+}
+
+
+
+/*
+ * Explicit instantiations.
+ */
+
+template Rnfpp Rnbpp :: widen (void) const;
+template Rndpp Rndpp :: widen (void) const;
+template Rnfpp Rnfpp :: widen (void) const;
+template Rnfpp Rnhpp :: widen (void) const;
+
+/******************************************************************************/